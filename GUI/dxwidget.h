@@ -1,325 +1,908 @@
-#pragma once
-
-#include "../common/common.h"
-#include "../common/camera.h"
-
-#include <QWidget.h>
-#include <QtGui/QResizeEvent>
-#include <QtGui/QMainWindow.h>
-#include <QtGui/QStatusBar.h>
-#include <QtGui/QVector2D.h>
-#include <QtGui/QVector3D.h>
-#include <QtGui/QVector4D.h>
-
-class DXWidget : public QWidget
-{
-	Q_OBJECT
-
-public:
-	BT_DECLARE_ALIGNED_ALLOCATOR()
-
-	DXWidget( QWidget *parent = 0, Qt::WFlags flags = 0 ) : QWidget( parent, flags )
-	{
-		setAttribute(Qt::WA_PaintOnScreen);
-		setAttribute(Qt::WA_NoSystemBackground);
-
-		m_standBy = false;
-		m_lastRendered = 0;
-		m_fTime = 0;
-		m_camera = (Camera*)_aligned_malloc(sizeof(Camera),16);
-		m_camera->initialize();
-	}
-	virtual ~DXWidget()
-	{
-		_aligned_free(m_camera);
-	}
-
-	virtual void	setVisible(bool visible)
-	{
-		if(visible)
-		{
-			QWidget::setVisible(visible);
-			//initialize();
-		}
-		else
-		{
-			//uninitialize();
-			QWidget::setVisible(visible);
-		}
-	}
-
-	virtual HRESULT	initialize() = 0;
-	virtual void	uninitialize() = 0;
-
-	virtual HRESULT	restoreDeviceObjects() = 0;
-	virtual HRESULT	invalidateDeviceObjects() = 0;
-
-	virtual void setTime(double fTime)
-	{
-		m_fTime = fTime;
-	}
-
-	virtual HRESULT	render()
-	{
-		return S_OK;
-	}
-
-	virtual HRESULT	present()
-	{
-		return S_OK;
-	}
-
-	virtual void	initCamera()
-	{
-		perspective( 45.0f, width() / (float)height(), 0.1f, 5000.0f );
-		lookAtCamera( vmVector3( 3.857, 2.5, -3.857 ), vmVector3( 0, 0, 0 ), vmVector3( 0, 1, 0 ) );
-	}
-
-	void setAspect(float aspect)
-	{
-		m_camera->setAspect(aspect);
-	}
-
-	void perspective(float fovx, float aspect, float znear, float zfar)
-	{
-		m_camera->perspective(fovx, aspect, znear, zfar);
-		emit setAngleOfView((double)fovx);
-		emit setNearClipPlane((double)znear);
-		emit setFarClipPlane((double)zfar);
-	}
-
-	void moveCamera(float dx, float dy, float dz)
-	{
-		m_camera->move(dx, dy, dz);
-
-		vmVector3 target = m_camera->getTarget();
-		emit setCameraTranslate(QVector3D(target[0], target[1], target[2]));
-	}
-
-	void rotateCamera(float headingDegrees, float pitchDegrees, float rollDegrees)
-	{
-		m_camera->rotate(headingDegrees, pitchDegrees, rollDegrees);
-
-		vmVector3 euler;
-		if(m_camera->getEulerAngle(euler))
-		{
-			emit setCameraRotate(QVector3D(btDegrees(euler[0]), btDegrees(euler[1]), btDegrees(euler[2])));
-		}
-	}
-
-	void zoomCamera(float zoom)
-	{
-		m_camera->zoom(zoom);
-
-		emit setCenterOfInterest((double)m_camera->getCenterOfInterest());
-	}
-
-	void lookAtCamera(const vmVector3 &eye, const vmVector3 &target, const vmVector3 &up)
-	{
-		m_camera->lookAt(eye, target, up);
-
-		emit setCameraTranslate(QVector3D(target[0], target[1], target[2]));
-
-		emit setCenterOfInterest((double)m_camera->getCenterOfInterest());
-
-		vmVector3 euler;
-		if(m_camera->getEulerAngle(euler))
-		{
-			emit setCameraRotate(QVector3D(btDegrees(euler[0]), btDegrees(euler[1]), btDegrees(euler[2])));
-		}
-
-		emit setCameraScale(QVector3D(1, 1, 1));
-	}
-
-signals:
-	void	setCameraTranslate(QVector3D);
-	void	setCameraRotate(QVector3D);
-	void	setCameraScale(QVector3D);
-	void	setCenterOfInterest(double);
-	void	setAngleOfView(double);
-	void	setNearClipPlane(double);
-	void	setFarClipPlane(double);
-
-public slots:
-	void	cameraTranslateChanged(QVector3D p)
-	{
-		m_camera->setTarget(vmVector3(p.x(), p.y(), p.z()));
-		update();
-	}
-
-	void	cameraRotateChanged(QVector3D p)
-	{
-		m_camera->setEulerAngle(vmVector3(btRadians(p.x()), btRadians(p.y()), btRadians(p.z())));
-		update();
-	}
-
-	void	cameraScaleChanged(QVector3D p)
-	{
-	}
-
-	void	angleOfViewChanged(double value)
-	{
-		m_camera->setFovx(value);
-		update();
-	}
-
-	void	nearClipPlaneChanged(double value)
-	{
-		m_camera->setZnear(value);
-		update();
-	}
-
-	void	farClipPlaneChanged(double value)
-	{
-		m_camera->setZfar(value);
-		update();
-	}
-
-	void	centerOfInterestChanged(double value)
-	{
-		m_camera->setCenterOfInterest(value);
-		update();
-	}
-
-protected:
-	QPaintEngine *paintEngine() const { return 0; } 
-	virtual void onResize(UINT, UINT) = 0;
-
-	virtual void	paintEvent(QPaintEvent *e)
-	{
-		Q_UNUSED(e);
-		render();
-	}
-
-	virtual void	resizeEvent(QResizeEvent *p_event)
-	{
-		QSize newSize = size();
-		if(p_event)
-		{
-			newSize = p_event->size();
-			// if( width()==newSize.width() && height()==newSize.height() ) return;
-			QWidget::resizeEvent( p_event );
-		}
-		onResize(newSize.width(), newSize.height());
-	}
-
-	void keyPressEvent(QKeyEvent *e)
-	{
-		switch (e->key()) {
-			//case Qt::Key_Escape:
-				break;
-			default:
-				QWidget::keyPressEvent(e);
-		}
-	}
-
-	const vmMatrix4& ViewMatrix() const 
-	{
-		return m_camera->getViewMatrix();
-	}
-
-	const vmMatrix4& ProjMatrix() const 
-	{
-		return m_camera->getProjMatrix();
-	}
-
-	static bool isCameraOperation(QMouseEvent *e)
-	{
-		return true/*e->modifiers() == Qt::AltModifier*/;
-	}
-
-	void showStatus(const QString &message)
-	{
-		qobject_cast<QMainWindow*>(parent())->statusBar()->showMessage(message);
-	}
-
-	void mousePressEvent(QMouseEvent *e)
-	{
-		m_clickPos = e->posF();
-
-		if(isCameraOperation(e))
-		{
-			m_camera->backup();
-
-			if((e->buttons() & Qt::LeftButton) && !(e->buttons() & Qt::RightButton))
-			{
-				// Shift to constrain rotaion
-				showStatus(tr("Tumble Tool: LMB Drag: Use LMB or MMB to tumble"));
-				setCursor(Qt::OpenHandCursor);
-			}
-			else if((e->buttons() & Qt::RightButton) && !(e->buttons() & Qt::LeftButton))
-			{
-				showStatus(tr("Dolly Tool: RMB Drag: Use mouse to dolly"));
-				setCursor(Qt::SizeVerCursor);
-			}
-			else if(e->buttons() & Qt::MiddleButton)
-			{
-				showStatus(tr("Track Tool: MMB Drag: Use LMB or MMB to track"));
-				setCursor(Qt::SizeAllCursor);
-			}
-		}
-
-		QWidget::mousePressEvent(e);
-	}
-
-	void mouseMoveEvent(QMouseEvent *e)
-	{
-		if(isCameraOperation(e) && height()>0)
-		{
-			if((e->buttons() & Qt::LeftButton) && !(e->buttons() & Qt::RightButton))
-			{
-				QPointF delta = (e->posF() - m_clickPos) / (float)height() * 180.0f;
-				m_camera->recover();
-				rotateCamera( delta.x(), delta.y(), 0.0f );
-				update();
-			}
-			else if((e->buttons() & Qt::RightButton) && !(e->buttons() & Qt::LeftButton))
-			{
-				QPointF delta = (e->posF() - m_clickPos) / (float)height() * m_camera->getCenterOfInterest();
-				m_camera->recover();
-				moveCamera( 0, 0, delta.y() );
-				update();
-			}
-			else if(e->buttons() & Qt::MiddleButton)
-			{
-				QPointF delta = (e->posF() - m_clickPos) / (float)height() * m_camera->getCenterOfInterest();
-				m_camera->recover();
-				moveCamera( -delta.x(), delta.y(), 0.0f );
-				update();
-			}
-		}
-
-		QWidget::mouseMoveEvent(e);
-	}
-
-	void mouseReleaseEvent(QMouseEvent *e)
-	{
-		setCursor(Qt::ArrowCursor);
-		showStatus("");
-		
-		QWidget::mouseReleaseEvent(e);
-	}
-
-	void wheelEvent(QWheelEvent *e)
-	{
-		QWidget::wheelEvent(e);
-
-		zoomCamera(1.0f - (e->delta() / WHEEL_DELTA) * 0.125f);
-		update();
-	}
-
-	//! Pointer of Camera for 16-byte alignment
-	Camera*	m_camera;	
-
-	//! if stand-by mode
-	bool	m_standBy;
-
-	//! Last updated time
-	double	m_lastRendered;
-
-	//! Clicked mouse position
-	QPointF	m_clickPos;
-
-	//! Time
-	double	m_fTime;
-};
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+#include "../common/cameracontroller.h"
+#include "../common/camerasnapshot.h"
+#include "../common/cameratrack.h"
+#include "../common/frameclock.h"
+#include "../common/framestats.h"
+#include "../common/profiler.h"
+#include "../common/renderscheduler.h"
+#include "../common/renderthread.h"
+#include "../common/resizepolicy.h"
+#include "../common/timer.h"
+
+#include <QWidget.h>
+#include <QtCore/QTimer>
+#include <QtGui/QResizeEvent>
+#include <QtGui/QMainWindow.h>
+#include <QtGui/QStatusBar.h>
+#include <QtGui/QVector2D.h>
+#include <QtGui/QVector3D.h>
+#include <QtGui/QVector4D.h>
+
+class DXWidget : public QWidget, public RenderBackend
+{
+	Q_OBJECT
+
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	DXWidget( QWidget *parent = 0, Qt::WFlags flags = 0 ) : QWidget( parent, flags )
+	{
+		setAttribute(Qt::WA_PaintOnScreen);
+		setAttribute(Qt::WA_NoSystemBackground);
+
+		m_standBy = false;
+		m_rotateDirty = true;
+		m_rotateFeedback = true;
+		m_lastRendered = 0;
+		m_fTime = 0;
+		m_uiTime = 0;
+		m_renderThread = 0;
+		m_flushScheduled = false;
+		m_resumeRenderThread = false;
+		m_deviceLost = false;
+		m_settleScheduled = false;
+		m_showFrameStats = true;
+		m_camera = (Camera*)_aligned_malloc(sizeof(Camera),16);
+		m_camera->initialize();
+		m_emittedOrientation[0] = m_emittedOrientation[1] = m_emittedOrientation[2] = m_emittedOrientation[3] = 0.0f;
+
+		m_cameraSnapshot = new CameraSnapshotBuffer;
+		m_renderCamera = new CameraSnapshot;
+		publishCamera();
+		latchCamera();
+	}
+	virtual ~DXWidget()
+	{
+		stopRenderThread();
+		if(!m_frameStatsFile.empty())
+		{
+			m_frameStats.dumpCsv(m_frameStatsFile.c_str());
+		}
+		delete m_renderCamera;
+		delete m_cameraSnapshot;
+		_aligned_free(m_camera);
+	}
+
+	virtual void	setVisible(bool visible)
+	{
+		if(visible)
+		{
+			QWidget::setVisible(visible);
+			//initialize();
+		}
+		else
+		{
+			//uninitialize();
+			QWidget::setVisible(visible);
+		}
+	}
+
+	virtual HRESULT	initialize() = 0;
+	virtual void	uninitialize() = 0;
+
+	virtual HRESULT	restoreDeviceObjects() = 0;
+	virtual HRESULT	invalidateDeviceObjects() = 0;
+
+	//! Replace a lost device, on the UI thread with no render thread running
+	virtual HRESULT	recreateDevice()
+	{
+		uninitialize();
+		return initialize();
+	}
+
+	virtual void setTime(double fTime)
+	{
+		m_fTime = fTime;
+	}
+
+	//! Render at the clock's interpolated time so animation stays smooth between fixed steps
+	void setTime(const FrameClock &clock)
+	{
+		double fTime = clock.getInterpolatedTime();
+		if(fTime == m_uiTime) return;
+		m_uiTime = fTime;
+
+		if(m_renderThread)
+		{
+			m_renderThread->post(RenderCommand::setTime(fTime));
+		}
+		else
+		{
+			setTime(fTime);
+		}
+
+		if(isTimeDependent())
+		{
+			requestFrame(RenderScheduler::DIRTY_TIME);
+		}
+	}
+
+	//! false if the scene looks the same at any time, so animation ticks cost no frames
+	virtual bool	isTimeDependent() const
+	{
+		return true;
+	}
+
+	//! Frames rendered and repaint requests absorbed by the scheduler
+	const RenderScheduler&	renderScheduler() const
+	{
+		return m_scheduler;
+	}
+
+	virtual HRESULT	render()
+	{
+		return S_OK;
+	}
+
+	virtual HRESULT	present()
+	{
+		return S_OK;
+	}
+
+	virtual void	initCamera()
+	{
+		perspective( 45.0f, width() / (float)height(), 0.1f, 5000.0f );
+		lookAtCamera( vmVector3( 3.857, 2.5, -3.857 ), vmVector3( 0, 0, 0 ), vmVector3( 0, 1, 0 ) );
+	}
+
+	void setAspect(float aspect)
+	{
+		// on the render thread the UI has already published the new aspect with the resize
+		if(!isRenderThread())
+		{
+			m_camera->setAspect(aspect);
+			publishCamera();
+		}
+
+		// backends render straight from onResize, outside paintEvent
+		latchCamera();
+	}
+
+	/*!
+		Move render() and present() onto their own thread. Call after initialize();
+		backends have to stopRenderThread() before releasing their device.
+	*/
+	void	startRenderThread()
+	{
+		if(m_renderThread) return;
+
+		m_renderThread = new RenderThread(this);
+		if(!m_renderThread->start())
+		{
+			delete m_renderThread;
+			m_renderThread = 0;
+		}
+	}
+
+	//! Finish the queued commands and render on the UI thread again
+	void	stopRenderThread()
+	{
+		if(!m_renderThread || isRenderThread()) return;
+
+		m_renderThread->stop();
+		delete m_renderThread;
+		m_renderThread = 0;
+	}
+
+	bool	isRenderThread() const
+	{
+		return m_renderThread && m_renderThread->isCurrent();
+	}
+
+	void perspective(float fovx, float aspect, float znear, float zfar)
+	{
+		m_camera->perspective(fovx, aspect, znear, zfar);
+		publishCamera();
+		emit setAngleOfView((double)fovx);
+		emit setNearClipPlane((double)znear);
+		emit setFarClipPlane((double)zfar);
+	}
+
+	void moveCamera(float dx, float dy, float dz)
+	{
+		m_camera->move(dx, dy, dz);
+		publishCamera();
+
+		emitCameraTranslate();
+	}
+
+	void rotateCamera(float headingDegrees, float pitchDegrees, float rollDegrees)
+	{
+		m_camera->rotate(headingDegrees, pitchDegrees, rollDegrees);
+		publishCamera();
+
+		markCameraRotate();
+	}
+
+	void zoomCamera(float zoom)
+	{
+		m_camera->zoom(zoom);
+		publishCamera();
+
+		emit setCenterOfInterest((double)m_camera->getCenterOfInterest());
+	}
+
+	void lookAtCamera(const vmVector3 &eye, const vmVector3 &target, const vmVector3 &up)
+	{
+		m_camera->lookAt(eye, target, up);
+		publishCamera();
+
+		emit setCameraTranslate(QVector3D(target[0], target[1], target[2]));
+
+		emit setCenterOfInterest((double)m_camera->getCenterOfInterest());
+
+		markCameraRotate();
+
+		emit setCameraScale(QVector3D(1, 1, 1));
+	}
+
+	//! Smooth mouse camera operations with a critically damped spring
+	void	setCameraSmoothing(bool enabled, float smoothTime = 0.08f)
+	{
+		m_cameraController.setSmoothing(enabled, smoothTime);
+	}
+
+	//! Start sampling the camera on every rendered frame
+	void	startCameraRecording()
+	{
+		m_trackTimer.reset();
+		m_trackRecorder.start();
+	}
+
+	//! Stop sampling and save the track
+	bool	stopCameraRecording(const char *fileName)
+	{
+		m_trackRecorder.stop();
+		return m_trackRecorder.track().save(fileName);
+	}
+
+	//! Rolling frame time percentiles in the status bar, about once a second
+	void	setShowFrameStats(bool show)
+	{
+		m_showFrameStats = show;
+	}
+
+	//! CSV written on F12 and when the widget is destroyed
+	void	setFrameStatsFile(const char *filename)
+	{
+		m_frameStatsFile = filename ? filename : "";
+	}
+
+	bool	dumpFrameStats()
+	{
+		const char *filename = m_frameStatsFile.empty() ? "framestats.csv" : m_frameStatsFile.c_str();
+		return m_frameStats.dumpCsv(filename);
+	}
+
+	const FrameStats&	frameStats() const
+	{
+		return m_frameStats;
+	}
+
+	//! Debounce time and applied / held back resize counts
+	ResizePolicy&	resizePolicy()
+	{
+		return m_resizePolicy;
+	}
+
+	//! Raw input event and applied update counters
+	const CameraController&	cameraController() const
+	{
+		return m_cameraController;
+	}
+
+	/*!
+		Replay a recorded track at a fixed timestep, dumping frame times when it
+		ends. A running render thread is stopped for the replay and started
+		again afterwards.
+	*/
+	bool	playCameraTrack(const char *trackFile, const char *frameTimeFile = 0, double step = 1.0 / 60.0)
+	{
+		if(!m_trackPlayer.load(trackFile)) return false;
+
+		// replay renders synchronously so the frame times measure render() alone
+		if(m_renderThread)
+		{
+			m_resumeRenderThread = true;
+			stopRenderThread();
+		}
+
+		m_frameTimeFile = frameTimeFile ? frameTimeFile : "";
+		m_trackPlayer.start(step);
+		update();
+		return true;
+	}
+
+signals:
+	void	setCameraTranslate(QVector3D);
+	void	setCameraRotate(QVector3D);
+	void	setCameraScale(QVector3D);
+	void	setCenterOfInterest(double);
+	void	setAngleOfView(double);
+	void	setNearClipPlane(double);
+	void	setFarClipPlane(double);
+
+private slots:
+	void	flushRenderThread()
+	{
+		m_flushScheduled = false;
+		if(m_renderThread)
+		{
+			m_renderThread->flush();
+			scheduleRenderFlush();
+		}
+	}
+
+	//! Replace the device deviceLost() reported; the camera is left as it is
+	void	recoverDevice()
+	{
+		bool resume = m_renderThread != 0;
+		stopRenderThread();
+
+		HRESULT hr = recreateDevice();
+		m_deviceLost = false;
+		if(SUCCEEDED(hr) && resume)
+		{
+			startRenderThread();
+		}
+		requestFrame(RenderScheduler::DIRTY_PROPERTY);
+	}
+
+	//! The end of a resize storm: hand the last size to the renderer
+	void	settleResize()
+	{
+		m_settleScheduled = false;
+		switch(m_resizePolicy.settle())
+		{
+		case ResizePolicy::ACTION_APPLY:
+			applyResize(m_resizePolicy.getWidth(), m_resizePolicy.getHeight());
+			break;
+		case ResizePolicy::ACTION_DEFER:
+			scheduleResizeSettle();
+			break;
+		default:
+			break;
+		}
+	}
+
+public slots:
+	/*!
+		Whether the listeners of the camera signals are on screen, e.g. a dock's
+		visibilityChanged. Hidden listeners get no Euler feedback; shown again,
+		they receive the current angles with the next frame.
+	*/
+	void	setCameraFeedback(bool visible)
+	{
+		if(visible == m_rotateFeedback) return;
+		m_rotateFeedback = visible;
+		if(visible)
+		{
+			m_emittedOrientation[0] = m_emittedOrientation[1] = m_emittedOrientation[2] = m_emittedOrientation[3] = 0.0f;
+			m_rotateDirty = true;
+			requestFrame(RenderScheduler::DIRTY_CAMERA);
+		}
+	}
+
+	void	cameraTranslateChanged(QVector3D p)
+	{
+		m_camera->setTarget(vmVector3(p.x(), p.y(), p.z()));
+		publishCamera();
+		requestFrame(RenderScheduler::DIRTY_CAMERA);
+	}
+
+	void	cameraRotateChanged(QVector3D p)
+	{
+		m_camera->setEulerAngle(vmVector3(btRadians(p.x()), btRadians(p.y()), btRadians(p.z())));
+		publishCamera();
+
+		// the panel already shows these angles, don't echo them back
+		acknowledgeCameraRotate();
+		requestFrame(RenderScheduler::DIRTY_CAMERA);
+	}
+
+	void	cameraScaleChanged(QVector3D p)
+	{
+	}
+
+	void	angleOfViewChanged(double value)
+	{
+		m_camera->setFovx(value);
+		publishCamera();
+		requestFrame(RenderScheduler::DIRTY_PROPERTY);
+	}
+
+	void	nearClipPlaneChanged(double value)
+	{
+		m_camera->setZnear(value);
+		publishCamera();
+		requestFrame(RenderScheduler::DIRTY_PROPERTY);
+	}
+
+	void	farClipPlaneChanged(double value)
+	{
+		m_camera->setZfar(value);
+		publishCamera();
+		requestFrame(RenderScheduler::DIRTY_PROPERTY);
+	}
+
+	void	centerOfInterestChanged(double value)
+	{
+		m_camera->setCenterOfInterest(value);
+		publishCamera();
+		requestFrame(RenderScheduler::DIRTY_PROPERTY);
+	}
+
+protected:
+	QPaintEngine *paintEngine() const { return 0; } 
+	virtual void onResize(UINT, UINT) = 0;
+
+	virtual void	paintEvent(QPaintEvent *e)
+	{
+		Q_UNUSED(e);
+		PROFILE_FRAME("frame");
+		PROFILE_FUNCTION();
+
+		// system exposes land here as well, so a frame is drawn even when nothing is dirty
+		m_scheduler.beginFrame();
+
+		if(m_trackPlayer.isPlaying())
+		{
+			// Replayed frames ignore wall time so every run sees the same sequence
+			m_trackPlayer.step(*m_camera);
+			publishCamera();
+			latchCamera();
+			setTime(m_trackPlayer.time());
+
+			HighResolutionTimer frameTimer;
+			render();
+			m_trackPlayer.recordFrameTime(frameTimer.milliseconds());
+
+			if(m_trackPlayer.isPlaying())
+			{
+				update();
+				return;
+			}
+
+			if(!m_frameTimeFile.empty())
+			{
+				m_trackPlayer.dumpFrameTimes(m_frameTimeFile.c_str());
+			}
+			if(m_resumeRenderThread)
+			{
+				m_resumeRenderThread = false;
+				startRenderThread();
+			}
+			return;
+		}
+
+		{
+			FrameStats::Scope updateScope(m_frameStats, FrameStats::PHASE_UPDATE);
+
+			applyCameraInput();
+
+			if(m_trackRecorder.isRecording())
+			{
+				m_trackRecorder.sample(m_trackTimer.seconds(), *m_camera);
+			}
+
+			flushCameraRotate();
+
+			if(m_renderThread)
+			{
+				m_renderThread->post(RenderCommand::camera());
+				m_renderThread->requestFrame();
+				scheduleRenderFlush();
+			}
+		}
+
+		if(!m_renderThread)
+		{
+			latchCamera();
+			renderFrame();
+		}
+
+		showFrameStats();
+	}
+
+	//! A new rotate listener gets the current angles on the next frame
+	virtual void	connectNotify(const char *signal)
+	{
+		QWidget::connectNotify(signal);
+
+		if(QLatin1String(signal) == SIGNAL(setCameraRotate(QVector3D)))
+		{
+			m_emittedOrientation[0] = m_emittedOrientation[1] = m_emittedOrientation[2] = m_emittedOrientation[3] = 0.0f;
+			m_rotateDirty = true;
+			requestFrame(RenderScheduler::DIRTY_CAMERA);
+		}
+	}
+
+	virtual void	resizeEvent(QResizeEvent *p_event)
+	{
+		QSize newSize = size();
+		if(p_event)
+		{
+			newSize = p_event->size();
+			// if( width()==newSize.width() && height()==newSize.height() ) return;
+			QWidget::resizeEvent( p_event );
+		}
+
+		// the aspect follows at once; until the buffers do, present() stretches the old ones
+		if(newSize.height() > 0)
+		{
+			m_camera->setAspect(newSize.width() / (float)newSize.height());
+			publishCamera();
+		}
+
+		if(m_resizePolicy.request(newSize.width(), newSize.height()) == ResizePolicy::ACTION_APPLY)
+		{
+			applyResize(newSize.width(), newSize.height());
+			return;
+		}
+
+		if(m_resizePolicy.isPending())
+		{
+			scheduleResizeSettle();
+		}
+		requestFrame(RenderScheduler::DIRTY_RESIZE);
+	}
+
+	//! Reallocate the backend's buffers, on the render thread when it runs
+	void	applyResize(UINT width, UINT height)
+	{
+		if(m_renderThread)
+		{
+			m_renderThread->post(RenderCommand::resize(width, height));
+			scheduleRenderFlush();
+			return;
+		}
+		onResize(width, height);
+	}
+
+	void	scheduleResizeSettle()
+	{
+		if(!m_settleScheduled)
+		{
+			m_settleScheduled = true;
+			QTimer::singleShot(std::max(m_resizePolicy.getSettleDelay(), 1), this, SLOT(settleResize()));
+		}
+	}
+
+	//! RenderBackend, called on the render thread
+	virtual void	renderLatchCamera()
+	{
+		latchCamera();
+	}
+
+	virtual void	renderSetTime(double fTime)
+	{
+		setTime(fTime);
+	}
+
+	virtual void	renderResize(UINT width, UINT height)
+	{
+		onResize(width, height);
+	}
+
+	virtual void	renderFrame()
+	{
+		// nothing to draw with until recoverDevice() ran
+		if(m_deviceLost) return;
+
+		FrameStats::Scope renderScope(m_frameStats, FrameStats::PHASE_RENDER);
+		PROFILE_FUNCTION();
+		render();
+	}
+
+	/*!
+		Called by present() when the device is gone. The device is recreated on
+		the UI thread, where the render thread can be stopped and the widget's
+		signals may be emitted; frames are skipped until then.
+	*/
+	void	deviceLost()
+	{
+		if(m_deviceLost) return;
+		m_deviceLost = true;
+		QMetaObject::invokeMethod(this, "recoverDevice", Qt::QueuedConnection);
+	}
+
+	//! Commands that did not fit into the render queue are retried shortly, without waiting
+	void	scheduleRenderFlush()
+	{
+		if(!m_flushScheduled && m_renderThread && m_renderThread->hasOverflow())
+		{
+			m_flushScheduled = true;
+			QTimer::singleShot(1, this, SLOT(flushRenderThread()));
+		}
+	}
+
+	void keyPressEvent(QKeyEvent *e)
+	{
+		switch (e->key()) {
+			//case Qt::Key_Escape:
+				break;
+			case Qt::Key_F12:
+				dumpFrameStats();
+				PROFILE_EXPORT("profile.json");
+				break;
+			default:
+				QWidget::keyPressEvent(e);
+		}
+	}
+
+	//! View matrix latched for the frame being rendered
+	const vmMatrix4& ViewMatrix() const 
+	{
+		return m_renderCamera->viewMatrix;
+	}
+
+	//! Projection matrix latched for the frame being rendered
+	const vmMatrix4& ProjMatrix() const 
+	{
+		return m_renderCamera->projMatrix;
+	}
+
+	//! Writer side: make the current camera visible to the renderer
+	void publishCamera()
+	{
+		m_cameraSnapshot->publish(*m_camera);
+	}
+
+	//! Reader side: take a consistent view/proj pair for the next render()
+	void latchCamera()
+	{
+		m_cameraSnapshot->read(*m_renderCamera);
+	}
+
+	void emitCameraTranslate()
+	{
+		vmVector3 target = m_camera->getTarget();
+		emit setCameraTranslate(QVector3D(target[0], target[1], target[2]));
+	}
+
+	//! Defer the Euler feedback to the end of the frame
+	void markCameraRotate()
+	{
+		m_rotateDirty = true;
+	}
+
+	//! Treat the current orientation as already shown by the listeners
+	void acknowledgeCameraRotate()
+	{
+		for(int i=0; i<4; ++i)
+		{
+			m_emittedOrientation[i] = m_camera->m_orientation[i];
+		}
+		m_rotateDirty = false;
+	}
+
+	/*!
+		Emit setCameraRotate at most once per frame, and only when someone listens,
+		the listeners are on screen and the orientation moved noticeably since the
+		last emit.
+	*/
+	void flushCameraRotate()
+	{
+		if(!m_rotateDirty) return;
+		m_rotateDirty = false;
+
+		if(!m_rotateFeedback || receivers(SIGNAL(setCameraRotate(QVector3D))) <= 0) return;
+
+		// |dot| of unit quaternions is cos(angle/2); this skips changes below ~0.05 degrees
+		const float sameRotation = 0.9999999f;
+
+		// q and -q are the same rotation
+		const vmQuat &q = m_camera->m_orientation;
+		float d = 0.0f;
+		for(int i=0; i<4; ++i)
+		{
+			d += m_emittedOrientation[i] * q[i];
+		}
+		if(fabsf(d) > sameRotation) return;
+
+		vmVector3 euler;
+		if(m_camera->getEulerAngle(euler))
+		{
+			acknowledgeCameraRotate();
+			emit setCameraRotate(QVector3D(btDegrees(euler[0]), btDegrees(euler[1]), btDegrees(euler[2])));
+		}
+	}
+
+	//! Schedule one repaint for the dirty sources, however many requests arrive before it
+	void requestFrame(int dirty)
+	{
+		if(!m_scheduler.invalidate(dirty)) return;
+
+		int delay = m_scheduler.getDelay();
+		if(delay > 0)
+		{
+			// hold the frame until the next refresh instead of rendering twice in one
+			QTimer::singleShot(delay, this, SLOT(update()));
+		}
+		else
+		{
+			update();
+		}
+	}
+
+	//! Apply the mouse input gathered since the last frame
+	void applyCameraInput()
+	{
+		float dt = (float)std::min(m_inputTimer.seconds(), 0.1);
+		m_inputTimer.reset();
+
+		int changed = m_cameraController.update(*m_camera, dt);
+		if(changed)
+		{
+			publishCamera();
+		}
+
+		if(changed & CameraController::CHANGED_TARGET)
+		{
+			emitCameraTranslate();
+		}
+		if(changed & CameraController::CHANGED_ORIENTATION)
+		{
+			markCameraRotate();
+		}
+		if(changed & CameraController::CHANGED_DISTANCE)
+		{
+			emit setCenterOfInterest((double)m_camera->getCenterOfInterest());
+		}
+
+		if(m_cameraController.isActive())
+		{
+			requestFrame(RenderScheduler::DIRTY_CAMERA);
+		}
+	}
+
+	static bool isCameraOperation(QMouseEvent *e)
+	{
+		return true/*e->modifiers() == Qt::AltModifier*/;
+	}
+
+	void showStatus(const QString &message)
+	{
+		qobject_cast<QMainWindow*>(parent())->statusBar()->showMessage(message);
+	}
+
+	//! Tool hints keep the status bar while a camera operation is running
+	void showFrameStats()
+	{
+		if(!m_showFrameStats || m_cameraController.operation() != CameraController::NONE) return;
+		if(m_statsTimer.seconds() < 1.0) return;
+
+		m_statsTimer.reset();
+		showStatus(QString::fromStdString(m_frameStats.format()));
+	}
+
+	void mousePressEvent(QMouseEvent *e)
+	{
+		m_clickPos = e->posF();
+
+		if(isCameraOperation(e))
+		{
+			CameraController::Operation op = CameraController::NONE;
+
+			if((e->buttons() & Qt::LeftButton) && !(e->buttons() & Qt::RightButton))
+			{
+				// Shift to constrain rotaion
+				showStatus(tr("Tumble Tool: LMB Drag: Use LMB or MMB to tumble"));
+				setCursor(Qt::OpenHandCursor);
+				op = CameraController::TUMBLE;
+			}
+			else if((e->buttons() & Qt::RightButton) && !(e->buttons() & Qt::LeftButton))
+			{
+				showStatus(tr("Dolly Tool: RMB Drag: Use mouse to dolly"));
+				setCursor(Qt::SizeVerCursor);
+				op = CameraController::DOLLY;
+			}
+			else if(e->buttons() & Qt::MiddleButton)
+			{
+				showStatus(tr("Track Tool: MMB Drag: Use LMB or MMB to track"));
+				setCursor(Qt::SizeAllCursor);
+				op = CameraController::TRACK;
+			}
+
+			m_cameraController.begin(op, *m_camera);
+		}
+
+		QWidget::mousePressEvent(e);
+	}
+
+	void mouseMoveEvent(QMouseEvent *e)
+	{
+		if(isCameraOperation(e) && height()>0 && m_cameraController.operation() != CameraController::NONE)
+		{
+			// Only the latest drag is kept, the camera is rebuilt once per frame in paintEvent
+			QPointF delta = (e->posF() - m_clickPos) / (float)height();
+			m_cameraController.drag(delta.x(), delta.y());
+			requestFrame(RenderScheduler::DIRTY_CAMERA);
+		}
+
+		QWidget::mouseMoveEvent(e);
+	}
+
+	void mouseReleaseEvent(QMouseEvent *e)
+	{
+		setCursor(Qt::ArrowCursor);
+		showStatus("");
+		m_cameraController.end();
+		
+		QWidget::mouseReleaseEvent(e);
+	}
+
+	void wheelEvent(QWheelEvent *e)
+	{
+		QWidget::wheelEvent(e);
+
+		// applied with the other input of this frame in applyCameraInput()
+		m_cameraController.zoom(1.0f - (e->delta() / (float)WHEEL_DELTA) * 0.125f);
+		requestFrame(RenderScheduler::DIRTY_CAMERA);
+	}
+
+	//! Pointer of Camera for 16-byte alignment
+	Camera*	m_camera;	
+
+	//! Camera state published by the UI side, read by render()
+	CameraSnapshotBuffer*	m_cameraSnapshot;
+	CameraSnapshot*			m_renderCamera;
+
+	//! if stand-by mode
+	bool	m_standBy;
+
+	//! Dirty tracking, at most one frame per refresh
+	RenderScheduler	m_scheduler;
+
+	//! Euler feedback: orientation last sent to setCameraRotate, pending flag
+	float	m_emittedOrientation[4];
+	bool	m_rotateDirty;
+	//! false while the listeners are hidden, see setCameraFeedback
+	bool	m_rotateFeedback;
+
+	//! Mouse input applied once per frame
+	CameraController	m_cameraController;
+	HighResolutionTimer	m_inputTimer;
+
+	//! Last updated time
+	double	m_lastRendered;
+
+	//! Clicked mouse position
+	QPointF	m_clickPos;
+
+	//! Time, owned by render()
+	double	m_fTime;
+
+	//! Last time handed to the renderer, UI side
+	double	m_uiTime;
+
+	//! Frame time instrumentation
+	FrameStats			m_frameStats;
+	HighResolutionTimer	m_statsTimer;
+	std::string			m_frameStatsFile;
+	bool				m_showFrameStats;
+
+	//! Renderer thread, 0 while render() runs on the UI thread
+	RenderThread*	m_renderThread;
+	bool			m_flushScheduled;
+	//! the render thread was stopped for a track replay and starts again when it ends
+	bool			m_resumeRenderThread;
+	//! set by deviceLost() on the thread that presents, cleared by recoverDevice() once that thread is stopped
+	bool			m_deviceLost;
+
+	//! Holds back resizes while the window is being dragged
+	ResizePolicy	m_resizePolicy;
+	bool			m_settleScheduled;
+
+	//! Camera flythrough recording
+	CameraTrackRecorder	m_trackRecorder;
+	HighResolutionTimer	m_trackTimer;
+
+	//! Camera flythrough playback
+	CameraTrackPlayer	m_trackPlayer;
+	std::string			m_frameTimeFile;
+};
@@ -1,12 +1,12 @@
-#include "qtd2dsample.h"
-
-QtD2DSample::QtD2DSample(QWidget *parent, Qt::WFlags flags)
-	: QMainWindow(parent, flags)
-{
-	ui.setupUi(this);
-}
-
-QtD2DSample::~QtD2DSample()
-{
-
-}
+#include "qtd2dsample.h"
+
+QtD2DSample::QtD2DSample(QWidget *parent, Qt::WFlags flags)
+	: QMainWindow(parent, flags)
+{
+	ui.setupUi(this);
+}
+
+QtD2DSample::~QtD2DSample()
+{
+
+}
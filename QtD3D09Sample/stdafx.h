@@ -1,4 +1,4 @@
-#define USE_D3D 9
-#include "../common/common.h"
-
-#include <QtGui>
+#define USE_D3D 9
+#include "../common/common.h"
+
+#include <QtGui>
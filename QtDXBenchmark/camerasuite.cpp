@@ -0,0 +1,115 @@
+/*!
+	@brief Update cost of Camera against CompactCamera for large camera sets
+	@author Shintaro Takemura
+*/
+
+#include "suites.h"
+#include "../common/camera.h"
+#include "../common/compactcamera.h"
+
+#include <cstdio>
+#include <sstream>
+
+namespace
+{
+	enum
+	{
+		ROUNDS = 64,
+	};
+
+	std::string resultName(const char *what, int count)
+	{
+		std::ostringstream name;
+		name << what << "_" << count;
+		return name.str();
+	}
+
+	//! The same small turn applied in every round
+	vmQuat turn()
+	{
+		return normalize(vmQuat::rotationY(0.001f) * vmQuat::rotationX(0.0005f));
+	}
+
+	void measure(SuiteResults &results, int count)
+	{
+		vmQuat delta = turn();
+		vmMatrix4 *viewMatrix = (vmMatrix4*)btAlignedAlloc(sizeof(vmMatrix4), 16);
+		float checksum = 0.0f;
+
+		// Camera: every update rewrites the matrix, the axes, the view direction and the eye
+		Camera *cameras = (Camera*)btAlignedAlloc(sizeof(Camera) * count, 16);
+		for(int n=0; n<count; ++n)
+		{
+			new(&cameras[n]) Camera;
+			cameras[n].initialize();
+			cameras[n].m_target = vmVector3((float)n, 0.0f, 0.0f);
+			cameras[n].m_centerOfInterest = 10.0f;
+		}
+
+		HighResolutionTimer timer;
+		for(int r=0; r<ROUNDS; ++r)
+		{
+			for(int n=0; n<count; ++n)
+			{
+				cameras[n].m_orientation = cameras[n].m_orientation * delta;
+				cameras[n].updateViewMatrix();
+			}
+		}
+		double cameraSeconds = timer.seconds();
+		checksum += cameras[count - 1].m_viewMatrix[3][0];
+		btAlignedFree(cameras);
+
+		// CompactCamera: the update only touches the quaternion
+		CompactCamera *compact = new CompactCamera[count];
+		for(int n=0; n<count; ++n)
+		{
+			compact[n].orientation = vmQuat::identity();
+			compact[n].target[0] = (float)n;
+			compact[n].target[1] = compact[n].target[2] = 0.0f;
+			compact[n].distance = 10.0f;
+		}
+
+		timer.reset();
+		for(int r=0; r<ROUNDS; ++r)
+		{
+			for(int n=0; n<count; ++n)
+			{
+				compact[n].orientation = normalize(compact[n].orientation * delta);
+			}
+		}
+		double stateSeconds = timer.seconds();
+
+		// CompactCamera with the view matrix derived right after, as a baker would
+		timer.reset();
+		for(int r=0; r<ROUNDS; ++r)
+		{
+			for(int n=0; n<count; ++n)
+			{
+				compact[n].orientation = normalize(compact[n].orientation * delta);
+				compact[n].buildViewMatrix(*viewMatrix);
+				checksum += (*viewMatrix)[3][0];
+			}
+		}
+		double derivedSeconds = timer.seconds();
+		delete[] compact;
+		btAlignedFree(viewMatrix);
+
+		long long updates = (long long)ROUNDS * count;
+		addResult(results, resultName("camera_update_ns", count), nanosecondsPer(cameraSeconds, updates), "ns");
+		addResult(results, resultName("compact_update_ns", count), nanosecondsPer(stateSeconds, updates), "ns");
+		addResult(results, resultName("compact_update_view_ns", count), nanosecondsPer(derivedSeconds, updates), "ns");
+
+		// keeps the loops from being optimized away
+		if(checksum == 12345.0f) printf("\n");
+	}
+}
+
+//! Per-camera cost of one orientation update for a cache-resident and a larger camera set
+void runCameraSuite(SuiteResults &results)
+{
+	addResult(results, "camera_bytes", (double)sizeof(Camera), "bytes");
+	addResult(results, "compact_camera_bytes", (double)sizeof(CompactCamera), "bytes");
+
+	measure(results, 4096);
+	measure(results, 65536);
+}
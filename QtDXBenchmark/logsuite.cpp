@@ -0,0 +1,428 @@
+/*!
+	@brief Logging costs: sinks, filtered levels, contention, timestamps and BinaryLog
+	@author Shintaro Takemura
+*/
+
+#include "suites.h"
+#include "../common/binarylog.h"
+#include "../common/logsink.h"
+#include "../common/logging.h"
+#include "../common/logstamp.h"
+#include "../common/atomic.h"
+#include "../common/thread.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+namespace
+{
+	const char *LOG_FILE = "QtDXBenchmark_suite.log";
+
+	//! One record as the render thread would log it
+	const char *RECORD = "frame 12345: camera moved to (12.500, -3.250, 100.000)\n";
+
+	//! What logging<T>::trace did for every record before the sinks
+	void writeReopened(const char *text)
+	{
+		FILE *fp = fopen(LOG_FILE, "a");
+		if(!fp) return;
+		fputs(text, fp);
+		fclose(fp);
+	}
+
+	//! Counts what reaches it, to show that filtered records do not
+	class CountingLogSink : public LogSink
+	{
+	public:
+		CountingLogSink() : m_records(0) {}
+
+		virtual void	write(int level, const char *text, size_t size)
+		{
+			(void)level;
+			(void)text;
+			(void)size;
+			++m_records;
+		}
+
+		int	m_records;
+	};
+
+	//! Stands in for an argument that is expensive to compute
+	float expensiveArgument(int n)
+	{
+		float sum = 0.0f;
+		for(int i=0; i<64; ++i)
+		{
+			sum += sqrtf((float)(n + i));
+		}
+		return sum;
+	}
+
+	//! Per-record latency in ns as seen by the caller
+	void timeSink(LogSink &sink, int records, std::vector<float> &samples)
+	{
+		size_t size = strlen(RECORD);
+		double toNs = 1.0e9 / (double)HighResolutionTimer::frequency();
+
+		samples.clear();
+		samples.reserve(records);
+		for(int n=0; n<records; ++n)
+		{
+			long long start = HighResolutionTimer::ticks();
+			sink.write(20, RECORD, size);
+			samples.push_back((float)((double)(HighResolutionTimer::ticks() - start) * toNs));
+		}
+	}
+
+	//! Logs 'records' lines through the shared logger once the gate opens, timing every call
+	class LogProducer : public Thread
+	{
+	public:
+		LogProducer(const AtomicInt &gate, int records) : m_gate(gate), m_records(records)
+		{
+			m_samples.reserve(records);
+		}
+
+		std::vector<float>	m_samples;
+
+	protected:
+		virtual void run()
+		{
+			double toNs = 1.0e9 / (double)HighResolutionTimer::frequency();
+			while(m_gate.load() == 0)
+			{
+				Thread::yield();
+			}
+
+			for(int n=0; n<m_records; ++n)
+			{
+				long long start = HighResolutionTimer::ticks();
+				logger.info("frame %d: camera moved to (%.3f, %.3f, %.3f)\n", n, 12.5, -3.25, 100.0);
+				m_samples.push_back((float)((double)(HighResolutionTimer::ticks() - start) * toNs));
+			}
+		}
+
+		const AtomicInt	&m_gate;
+		int		m_records;
+	};
+
+	//! "hh:mm:ss.uuuuuu [thread] " the usual way: wall clock, localtime and strftime on every record
+	int formatWallClock(char *text)
+	{
+		char hms[16];
+#ifdef _WIN32
+		FILETIME ft;
+		::GetSystemTimeAsFileTime(&ft);
+		long long hundreds = ((long long)ft.dwHighDateTime << 32 | ft.dwLowDateTime) - 116444736000000000LL;
+		time_t second = (time_t)(hundreds / 10000000LL);
+		int micro = (int)(hundreds % 10000000LL / 10);
+		unsigned int thread = (unsigned int)::GetCurrentThreadId();
+		tm local;
+		localtime_s(&local, &second);
+#else
+		timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		time_t second = ts.tv_sec;
+		int micro = (int)(ts.tv_nsec / 1000);
+		unsigned int thread = (unsigned int)(size_t)pthread_self();
+		tm local;
+		localtime_r(&second, &local);
+#endif
+		strftime(hms, sizeof(hms), "%H:%M:%S", &local);
+#ifdef _MSC_VER
+		return _snprintf_s(text, LogClock::TEXT_SIZE, _TRUNCATE, "%s.%06d [%u] ", hms, micro, thread);
+#else
+		return snprintf(text, LogClock::TEXT_SIZE, "%s.%06d [%u] ", hms, micro, thread);
+#endif
+	}
+}
+
+/*!
+	Latency of one record through the old open-append-close path and the
+	sinks that replaced it. The async sink is measured as a burst, so its
+	tail includes waits for a full ring; "_drain" adds the time until the
+	writer has flushed everything.
+*/
+void runLogSinkSuite(SuiteResults &results)
+{
+	const int REOPEN_RECORDS = 2000;
+	const int RECORDS = 100000;
+	double toNs = 1.0e9 / (double)HighResolutionTimer::frequency();
+
+	std::vector<float> samples;
+	samples.reserve(RECORDS);
+
+	remove(LOG_FILE);
+	for(int n=0; n<REOPEN_RECORDS; ++n)
+	{
+		long long start = HighResolutionTimer::ticks();
+		writeReopened(RECORD);
+		samples.push_back((float)((double)(HighResolutionTimer::ticks() - start) * toNs));
+	}
+	addSummary(results, "fopen_fputs_fclose", samples, "ns");
+
+	{
+		FileLogSink file;
+		file.open(LOG_FILE, true);
+		timeSink(file, RECORDS, samples);
+	}
+	addSummary(results, "file_sink", samples, "ns");
+
+	{
+		MappedLogSink mapped;
+		mapped.open(LOG_FILE, 8 * 1024 * 1024, 0);
+		timeSink(mapped, RECORDS, samples);
+	}
+	addSummary(results, "mapped_sink", samples, "ns");
+
+	{
+		FileLogSink file;
+		file.open(LOG_FILE, true);
+		AsyncLogSink async(&file);
+		async.setOverflow(AsyncLogSink::OVERFLOW_BLOCK);
+
+		HighResolutionTimer timer;
+		timeSink(async, RECORDS, samples);
+		async.flush();
+		addSummary(results, "async_sink", samples, "ns");
+		addResult(results, "async_sink_drain_ns", nanosecondsPer(timer.seconds(), RECORDS), "ns");
+		addResult(results, "async_sink_batches", (double)async.batches(), "writes");
+	}
+
+	remove(LOG_FILE);
+}
+
+/*!
+	Cost of log calls that do not log, per call, against the same loop
+	without one. DEBUG is below LOGGING_MIN_LEVEL in release builds and
+	compiled out; INFO is compiled in and filtered by the configured level.
+*/
+void runLogLevelSuite(SuiteResults &results)
+{
+	const int CALLS = 50000000;
+
+	CountingLogSink counting;
+	logger.setSink(&counting);
+	logger.setLevel(logging<char>::WARN);
+
+	volatile int sink = 0;
+
+	HighResolutionTimer timer;
+	for(int n=0; n<CALLS; ++n)
+	{
+		sink = n;
+	}
+	double baseline = nanosecondsPer(timer.seconds(), CALLS);
+
+	timer.reset();
+	for(int n=0; n<CALLS; ++n)
+	{
+		sink = n;
+		LOG_DEBUG(logger, "frame %d: %f\n", n, expensiveArgument(n));
+	}
+	double compiledOut = nanosecondsPer(timer.seconds(), CALLS);
+
+	timer.reset();
+	for(int n=0; n<CALLS; ++n)
+	{
+		sink = n;
+		LOG_INFO(logger, "frame %d: %f\n", n, expensiveArgument(n));
+	}
+	double filtered = nanosecondsPer(timer.seconds(), CALLS);
+
+	timer.reset();
+	for(int n=0; n<CALLS; ++n)
+	{
+		sink = n;
+		logger.info("frame %d\n", n);
+	}
+	double filteredCall = nanosecondsPer(timer.seconds(), CALLS);
+
+	// for scale: one record that is formatted and handed to the sink
+	const int ENABLED_CALLS = 1000000;
+	logger.setLevel(logging<char>::INFO);
+	timer.reset();
+	for(int n=0; n<ENABLED_CALLS; ++n)
+	{
+		sink = n;
+		LOG_INFO(logger, "frame %d: %f\n", n, expensiveArgument(n));
+	}
+	double enabled = nanosecondsPer(timer.seconds(), ENABLED_CALLS);
+
+	logger.setSink(0);
+	(void)sink;
+
+	addResult(results, "baseline_loop_ns", baseline, "ns");
+	addResult(results, "debug_compiled_out_ns", compiledOut - baseline, "ns");
+	addResult(results, "info_filtered_macro_ns", filtered - baseline, "ns");
+	addResult(results, "info_filtered_call_ns", filteredCall - baseline, "ns");
+	addResult(results, "info_enabled_ns", enabled - baseline, "ns");
+	addResult(results, "records_written", (double)counting.m_records, "records");
+}
+
+/*!
+	The shared logger under 1 to 32 threads logging at once, each formatting
+	into its own staging buffer and publishing into one AsyncLogSink. The
+	target only counts, so the numbers are the producers' side plus the
+	writer keeping up. "_ns_per_record" is the wall time of the whole burst
+	divided by the records; the summaries are per call.
+*/
+void runLogContentionSuite(SuiteResults &results)
+{
+	const int RECORDS = 256000;
+	const int THREADS[] = { 1, 2, 4, 8, 16, 32 };
+
+	for(size_t t=0; t<sizeof(THREADS) / sizeof(THREADS[0]); ++t)
+	{
+		int threads = THREADS[t];
+		char name[64];
+
+		CountingLogSink counting;
+		AsyncLogSink async(&counting, 4096);
+		async.setOverflow(AsyncLogSink::OVERFLOW_BLOCK);
+		logger.setSink(&async);
+		logger.setLevel(logging<char>::INFO);
+
+		AtomicInt gate(0);
+		std::vector<LogProducer*> producers;
+		for(int n=0; n<threads; ++n)
+		{
+			producers.push_back(new LogProducer(gate, RECORDS / threads));
+			producers.back()->start();
+		}
+
+		HighResolutionTimer timer;
+		gate.store(1);
+		std::vector<float> samples;
+		for(int n=0; n<threads; ++n)
+		{
+			producers[n]->join();
+			samples.insert(samples.end(), producers[n]->m_samples.begin(), producers[n]->m_samples.end());
+			delete producers[n];
+		}
+		async.flush();
+		double seconds = timer.seconds();
+		logger.setSink(0);
+
+		sprintf(name, "threads_%d", threads);
+		addResult(results, std::string(name) + "_ns_per_record", nanosecondsPer(seconds, RECORDS), "ns");
+		addSummary(results, std::string(name) + "_call", samples, "ns");
+		addResult(results, std::string(name) + "_batches", (double)async.batches(), "writes");
+	}
+}
+
+/*!
+	Per-record cost of a time and thread prefix. The old way reads the wall
+	clock, converts it with localtime and strftime and asks for the thread
+	id, all on the logging thread. With LogStamp the logging thread only
+	reads the counter and its cached id; LogClock formats at sink time,
+	on the writer, with localtime called once a second.
+*/
+void runLogStampSuite(SuiteResults &results)
+{
+	const int RECORDS = 2000000;
+
+	std::vector<LogStamp> stamps(RECORDS);
+	char text[LogClock::TEXT_SIZE];
+	volatile int length = 0;
+
+	HighResolutionTimer timer;
+	for(int n=0; n<RECORDS; ++n)
+	{
+		length = formatWallClock(text);
+	}
+	double wallClock = nanosecondsPer(timer.seconds(), RECORDS);
+
+	timer.reset();
+	for(int n=0; n<RECORDS; ++n)
+	{
+		stamps[n] = LogStamp::now();
+	}
+	double capture = nanosecondsPer(timer.seconds(), RECORDS);
+
+	LogClock clock;
+	clock.calibrate();
+	timer.reset();
+	for(int n=0; n<RECORDS; ++n)
+	{
+		length = clock.format(stamps[n].ticks, stamps[n].thread, text);
+	}
+	double format = nanosecondsPer(timer.seconds(), RECORDS);
+	(void)length;
+
+	addResult(results, "wallclock_localtime_strftime_ns", wallClock, "ns");
+	addResult(results, "logstamp_now_ns", capture, "ns");
+	addResult(results, "logclock_format_ns", format, "ns");
+	addResult(results, "logging_thread_saving", wallClock / capture, "x");
+}
+
+/*!
+	Caller side cost of one BINLOG_INFO, the same line LogProducer formats:
+	a timestamp, the record header and the raw arguments copied into the
+	thread's buffer. Bursts stay below the buffer's capacity and the writer
+	drains between them, untimed, so no call is dropped; "_ns" is the mean
+	per call, the summaries are per burst. "readticks_ns" is the timestamp
+	alone.
+*/
+void runBinaryLogSuite(SuiteResults &results)
+{
+	const int BURSTS = 4000;
+	const int BURST = 512;
+
+	CountingLogSink counting;
+	BinaryLog binlog(&counting);
+	binlog.setLevel(logging<char>::INFO);
+
+	// attach the thread's buffer before timing
+	BINLOG_INFO(binlog, "warm up");
+	binlog.flush();
+
+	std::string name("camera");
+	std::vector<float> scalars;
+	std::vector<float> strings;
+	double scalarSeconds = 0.0;
+	double stringSeconds = 0.0;
+
+	for(int b=0; b<BURSTS; ++b)
+	{
+		HighResolutionTimer timer;
+		for(int n=0; n<BURST; ++n)
+		{
+			BINLOG_INFO(binlog, "frame %d: camera moved to (%.3f, %.3f, %.3f)", n, 12.5, -3.25, 100.0);
+		}
+		double seconds = timer.seconds();
+		scalarSeconds += seconds;
+		scalars.push_back((float)nanosecondsPer(seconds, BURST));
+		binlog.flush();
+
+		timer.reset();
+		for(int n=0; n<BURST; ++n)
+		{
+			BINLOG_INFO(binlog, "frame %d: %s moved", n, name);
+		}
+		seconds = timer.seconds();
+		stringSeconds += seconds;
+		strings.push_back((float)nanosecondsPer(seconds, BURST));
+		binlog.flush();
+	}
+
+	// the timestamp's share; rdtsc is much slower in some virtual machines than on the host
+	volatile long long ticks = 0;
+	HighResolutionTimer timer;
+	for(int n=0; n<BURSTS * BURST; ++n)
+	{
+		ticks = LogStamp::readTicks();
+	}
+	double readTicks = nanosecondsPer(timer.seconds(), (long long)BURSTS * BURST);
+	(void)ticks;
+
+	addResult(results, "binlog_scalars_ns", nanosecondsPer(scalarSeconds, (long long)BURSTS * BURST), "ns");
+	addSummary(results, "binlog_scalars_burst", scalars, "ns");
+	addResult(results, "binlog_string_ns", nanosecondsPer(stringSeconds, (long long)BURSTS * BURST), "ns");
+	addSummary(results, "binlog_string_burst", strings, "ns");
+	addResult(results, "readticks_ns", readTicks, "ns");
+	addResult(results, "records_dropped", (double)binlog.dropped(), "records");
+	addResult(results, "sink_writes", (double)counting.m_records, "writes");
+}
@@ -0,0 +1,594 @@
+/*!
+	@brief Headless benchmark for the camera / render thread pipeline
+	@author Shintaro Takemura
+
+	Runs the same per-frame work as DXWidget (fixed-step clock, camera track
+	playback, camera snapshot, render thread) without Qt or a GPU. The DirectX
+	backends are replaced by a CPU renderer that builds the per-object
+	constants a backend would upload, so the numbers track the CPU side only.
+
+	Linux:
+		g++ -std=c++03 -O2 -msse2 *.cpp -o QtDXBenchmark -lpthread
+
+	Usage:
+		QtDXBenchmark [-frames N] [-warmup N] [-step seconds] [-objects N]
+		              [-size WxH] [-inline] [-track file.ctrk] [-out file.json]
+		QtDXBenchmark -suite name [-out file.json]
+
+	-suite runs one of the micro benchmarks in s_suites instead of the
+	pipeline.
+*/
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/camera.h"
+#include "../common/camerasnapshot.h"
+#include "../common/cameratrack.h"
+#include "../common/frameclock.h"
+#include "../common/framestats.h"
+#include "../common/renderthread.h"
+#include "../common/timer.h"
+#include "suites.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+//! Global heap traffic; aligned vectormath allocations go through btAlignedAlloc and are not counted
+static AtomicInt g_allocations;
+static AtomicInt g_frees;
+
+void* operator new(size_t size) throw(std::bad_alloc)
+{
+	g_allocations.fetchAdd(1);
+	void *p = malloc(size ? size : 1);
+	if(!p) throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t size) throw(std::bad_alloc)
+{
+	g_allocations.fetchAdd(1);
+	void *p = malloc(size ? size : 1);
+	if(!p) throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) throw()
+{
+	if(!p) return;
+	g_frees.fetchAdd(1);
+	free(p);
+}
+
+void operator delete[](void *p) throw()
+{
+	if(!p) return;
+	g_frees.fetchAdd(1);
+	free(p);
+}
+
+//! User + kernel time of the whole process in seconds
+static double processCpuSeconds()
+{
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	if(!::GetProcessTimes(::GetCurrentProcess(), &creation, &exit, &kernel, &user)) return 0.0;
+
+	ULARGE_INTEGER k, u;
+	k.LowPart = kernel.dwLowDateTime;
+	k.HighPart = kernel.dwHighDateTime;
+	u.LowPart = user.dwLowDateTime;
+	u.HighPart = user.dwHighDateTime;
+	return (double)(k.QuadPart + u.QuadPart) * 1.0e-7;
+#else
+	rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+	return (double)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+		+ (double)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1.0e-6;
+#endif
+}
+
+/*!
+	Stand-in for a DirectX backend: latches the camera like DXWidget and, per
+	object, does the work of a draw call's constant update (world matrix,
+	world-view-projection, visibility). Every call arrives on the render thread.
+*/
+class BenchmarkRenderer : public RenderBackend
+{
+public:
+	BenchmarkRenderer(const CameraSnapshotBuffer &snapshot, int objectCount, FrameStats &stats) :
+		m_snapshot(snapshot),
+		m_stats(stats),
+		m_objectCount(objectCount),
+		m_time(0.0),
+		m_width(1), m_height(1),
+		m_visibleTotal(0),
+		m_checksum(0.0)
+	{
+		m_camera = (CameraSnapshot*)btAlignedAlloc(sizeof(CameraSnapshot), 16);
+		m_positions = (vmVector3*)btAlignedAlloc(sizeof(vmVector3) * objectCount, 16);
+		m_constants = (vmMatrix4*)btAlignedAlloc(sizeof(vmMatrix4) * objectCount, 16);
+
+		// square grid on the ground plane, one unit apart
+		int side = (int)ceilf(sqrtf((float)objectCount));
+		for(int n=0; n<objectCount; ++n)
+		{
+			float x = (float)(n % side) - side * 0.5f;
+			float z = (float)(n / side) - side * 0.5f;
+			m_positions[n] = vmVector3(x * 2.0f, 0.0f, z * 2.0f);
+		}
+
+		m_renderTimes.reserve(1024);
+	}
+
+	virtual ~BenchmarkRenderer()
+	{
+		btAlignedFree(m_constants);
+		btAlignedFree(m_positions);
+		btAlignedFree(m_camera);
+	}
+
+	virtual void	renderLatchCamera()
+	{
+		m_snapshot.read(*m_camera);
+	}
+
+	virtual void	renderSetTime(double time)
+	{
+		m_time = time;
+	}
+
+	virtual void	renderResize(unsigned int width, unsigned int height)
+	{
+		m_width = width;
+		m_height = height;
+	}
+
+	virtual void	renderFrame()
+	{
+		HighResolutionTimer timer;
+		{
+			FrameStats::Scope renderScope(m_stats, FrameStats::PHASE_RENDER);
+			render();
+		}
+		m_renderTimes.push_back((float)timer.milliseconds());
+	}
+
+	//! Call before the measured frames so the result vector does not grow during them
+	void reserve(int frames)
+	{
+		m_renderTimes.reserve(frames);
+	}
+
+	void clearResults()
+	{
+		m_renderTimes.clear();
+		m_visibleTotal = 0;
+	}
+
+	//! Render thread results, read after the thread has been joined
+	const std::vector<float>& renderTimes() const
+	{
+		return m_renderTimes;
+	}
+
+	long long visibleTotal() const
+	{
+		return m_visibleTotal;
+	}
+
+	double checksum() const
+	{
+		return m_checksum;
+	}
+
+protected:
+	void render()
+	{
+		const float radius = 0.87f;	// unit cube
+		vmMatrix4 viewProj = m_camera->projMatrix * m_camera->viewMatrix;
+		vmMatrix4 spin = vmMatrix4::rotationY((float)m_time);
+
+		int visible = 0;
+		for(int n=0; n<m_objectCount; ++n)
+		{
+			vmMatrix4 world = spin;
+			world.setTranslation(m_positions[n]);
+
+			// sphere against the clip volume, z in [0,w]
+			vmVector4 c = viewProj * vmPoint3(m_positions[n]);
+			float w = c.getW() + radius;
+			if(c.getX() < -w || c.getX() > w || c.getY() < -w || c.getY() > w || c.getZ() < -radius || c.getZ() > w) continue;
+
+			m_constants[visible++] = viewProj * world;
+		}
+
+		if(visible > 0)
+		{
+			m_checksum += m_constants[visible - 1][3][3];
+		}
+		m_visibleTotal += visible;
+	}
+
+	const CameraSnapshotBuffer&	m_snapshot;
+	FrameStats&		m_stats;
+	CameraSnapshot*	m_camera;
+
+	vmVector3*	m_positions;
+	vmMatrix4*	m_constants;
+	int			m_objectCount;
+
+	double			m_time;
+	unsigned int	m_width;
+	unsigned int	m_height;
+
+	std::vector<float>	m_renderTimes;
+	long long			m_visibleTotal;
+	double				m_checksum;
+
+	BenchmarkRenderer& operator=(const BenchmarkRenderer&);
+};
+
+struct BenchmarkConfig
+{
+	int				frames;
+	int				warmup;
+	double			step;
+	int				objects;
+	unsigned int	width;
+	unsigned int	height;
+	bool			threaded;
+	const char*		track;
+	const char*		output;
+	const char*		suite;
+};
+
+struct Suite
+{
+	const char*	name;
+	void		(*run)(SuiteResults &results);
+};
+
+static const Suite s_suites[] =
+{
+	{ "camera",	runCameraSuite },
+	{ "logsink",	runLogSinkSuite },
+	{ "loglevel",	runLogLevelSuite },
+	{ "logcontention",	runLogContentionSuite },
+	{ "logstamp",	runLogStampSuite },
+	{ "binlog",	runBinaryLogSuite },
+	{ "profiler",	runProfilerSuite },
+};
+
+static void printUsage()
+{
+	fprintf(stderr,
+		"usage: QtDXBenchmark [-frames N] [-warmup N] [-step seconds] [-objects N]\n"
+		"                     [-size WxH] [-inline] [-track file.ctrk] [-out file.json]\n"
+		"       QtDXBenchmark -suite name [-out file.json]\n"
+		"suites:");
+	for(size_t n=0; n<sizeof(s_suites) / sizeof(s_suites[0]); ++n)
+	{
+		fprintf(stderr, " %s", s_suites[n].name);
+	}
+	fprintf(stderr, "\n");
+}
+
+static bool parseArguments(int argc, char *argv[], BenchmarkConfig &config)
+{
+	for(int i=1; i<argc; ++i)
+	{
+		const char *arg = argv[i];
+		const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+		if(strcmp(arg, "-inline") == 0)
+		{
+			config.threaded = false;
+			continue;
+		}
+		if(!value) return false;
+
+		if(strcmp(arg, "-frames") == 0) config.frames = atoi(value);
+		else if(strcmp(arg, "-warmup") == 0) config.warmup = atoi(value);
+		else if(strcmp(arg, "-step") == 0) config.step = atof(value);
+		else if(strcmp(arg, "-objects") == 0) config.objects = atoi(value);
+		else if(strcmp(arg, "-size") == 0)
+		{
+			if(sscanf(value, "%ux%u", &config.width, &config.height) != 2) return false;
+		}
+		else if(strcmp(arg, "-track") == 0) config.track = value;
+		else if(strcmp(arg, "-out") == 0) config.output = value;
+		else if(strcmp(arg, "-suite") == 0) config.suite = value;
+		else return false;
+		++i;
+	}
+
+	return config.frames > 0 && config.warmup >= 0 && config.step > 0.0
+		&& config.objects > 0 && config.width > 0 && config.height > 0;
+}
+
+//! Run the suite named in config.suite and write its results; the process exit code
+static int runSuite(const BenchmarkConfig &config)
+{
+	const Suite *suite = NULL;
+	for(size_t n=0; n<sizeof(s_suites) / sizeof(s_suites[0]); ++n)
+	{
+		if(strcmp(s_suites[n].name, config.suite) == 0) suite = &s_suites[n];
+	}
+	if(!suite)
+	{
+		printUsage();
+		return 2;
+	}
+
+	SuiteResults results;
+	suite->run(results);
+
+	if(!config.output) return 0;
+
+	FILE *fp = fopen(config.output, "w");
+	if(!fp)
+	{
+		fprintf(stderr, "QtDXBenchmark: cannot write '%s'\n", config.output);
+		return 1;
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "\t\"benchmark\": \"QtDXBenchmark\",\n");
+	fprintf(fp, "\t\"suite\": \"%s\",\n", suite->name);
+	fprintf(fp, "\t\"results\": {\n");
+	for(size_t n=0; n<results.size(); ++n)
+	{
+		fprintf(fp, "\t\t\"%s\": { \"value\": %.4f, \"unit\": \"%s\" }%s\n",
+			results[n].name.c_str(), results[n].value, results[n].unit, (n + 1 < results.size()) ? "," : "");
+	}
+	fprintf(fp, "\t}\n");
+	fprintf(fp, "}\n");
+	fclose(fp);
+	return 0;
+}
+
+//! One orbit around the grid with a slow pitch swing and a dolly in and out
+static void makeOrbitTrack(CameraTrack &track, double duration)
+{
+	Camera *camera = (Camera*)btAlignedAlloc(sizeof(Camera), 16);
+	camera->initialize();
+	camera->setCenterOfInterest(60.0f);
+	camera->rotate(0.0f, 25.0f, 0.0f);
+
+	const int KEYS = 32;
+	CameraTrackRecorder recorder;
+	recorder.start();
+	for(int k=0; k<=KEYS; ++k)
+	{
+		float t = (float)k / KEYS;
+		float pitch = (k == 0) ? 0.0f : 10.0f * (sinf(t * SIMD_2_PI) - sinf((t - 1.0f / KEYS) * SIMD_2_PI));
+
+		if(k > 0) camera->rotate(360.0f / KEYS, pitch, 0.0f);
+		camera->setCenterOfInterest(60.0f - 30.0f * sinf(t * SIMD_PI));
+		recorder.sample(t * duration, *camera);
+	}
+	recorder.stop();
+
+	track = recorder.track();
+	btAlignedFree(camera);
+}
+
+//! Nearest-rank percentiles, the same definition as FrameStats
+FrameStats::Summary summarize(std::vector<float> samples, double &mean)
+{
+	FrameStats::Summary summary = { 0, 0.0, 0.0, 0.0, 0.0 };
+	mean = 0.0;
+	if(samples.empty()) return summary;
+
+	std::sort(samples.begin(), samples.end());
+	summary.count = (int)samples.size();
+	summary.max = samples.back();
+
+	const double fractions[3] = { 0.50, 0.95, 0.99 };
+	double *results[3] = { &summary.p50, &summary.p95, &summary.p99 };
+	for(int i=0; i<3; ++i)
+	{
+		size_t rank = (size_t)ceil(fractions[i] * (double)samples.size());
+		*results[i] = samples[std::max(rank, (size_t)1) - 1];
+	}
+
+	for(size_t n=0; n<samples.size(); ++n)
+	{
+		mean += samples[n];
+	}
+	mean /= (double)samples.size();
+	return summary;
+}
+
+static void writeSummary(FILE *fp, const char *name, const std::vector<float> &samples, bool last)
+{
+	double mean;
+	FrameStats::Summary s = summarize(samples, mean);
+	fprintf(fp, "\t\"%s\": { \"count\": %d, \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }%s\n",
+		name, s.count, mean, s.p50, s.p95, s.p99, s.max, last ? "" : ",");
+}
+
+int main(int argc, char *argv[])
+{
+	BenchmarkConfig config;
+	config.frames = 2000;
+	config.warmup = 120;
+	config.step = 1.0 / 60.0;
+	config.objects = 4096;
+	config.width = 1280;
+	config.height = 720;
+	config.threaded = true;
+	config.track = NULL;
+	config.output = NULL;
+	config.suite = NULL;
+
+	if(!parseArguments(argc, argv, config))
+	{
+		printUsage();
+		return 2;
+	}
+
+	if(config.suite)
+	{
+		return runSuite(config);
+	}
+
+	int totalFrames = config.warmup + config.frames;
+
+	CameraTrackPlayer player;
+	if(config.track)
+	{
+		if(!player.load(config.track))
+		{
+			fprintf(stderr, "QtDXBenchmark: cannot load camera track '%s'\n", config.track);
+			return 1;
+		}
+	}
+	else
+	{
+		CameraTrack track;
+		makeOrbitTrack(track, totalFrames * config.step);
+		player.setTrack(track);
+	}
+	player.start(config.step);
+
+	Camera *camera = (Camera*)btAlignedAlloc(sizeof(Camera), 16);
+	camera->initialize();
+	camera->perspective(45.0f, config.width / (float)config.height, 0.1f, 5000.0f);
+
+	CameraSnapshotBuffer *snapshot = new CameraSnapshotBuffer;
+	FrameStats stats;
+	BenchmarkRenderer renderer(*snapshot, config.objects, stats);
+	renderer.reserve(totalFrames);
+
+	RenderThread renderThread(&renderer);
+	if(config.threaded && !renderThread.start())
+	{
+		fprintf(stderr, "QtDXBenchmark: cannot start the render thread\n");
+		return 1;
+	}
+
+	FrameClock clock;
+	clock.setFixedStep(config.step);
+	clock.setTargetRate(0.0);
+	clock.resume();
+
+	std::vector<float> frameTimes, updateTimes;
+	frameTimes.reserve(config.frames);
+	updateTimes.reserve(config.frames);
+
+	if(config.threaded)
+	{
+		renderThread.post(RenderCommand::resize(config.width, config.height));
+	}
+	else
+	{
+		renderer.renderResize(config.width, config.height);
+	}
+
+	HighResolutionTimer wallTimer;
+	double cpuStart = 0.0;
+	int allocationsStart = 0;
+	int freesStart = 0;
+
+	for(int frame=0; frame<totalFrames; ++frame)
+	{
+		if(frame == config.warmup)
+		{
+			renderer.clearResults();
+			wallTimer.reset();
+			cpuStart = processCpuSeconds();
+			allocationsStart = g_allocations.load();
+			freesStart = g_frees.load();
+		}
+
+		HighResolutionTimer frameTimer;
+
+		// the UI side of DXWidget::paintEvent and QtDXSample::idle
+		HighResolutionTimer updateTimer;
+		{
+			FrameStats::Scope updateScope(stats, FrameStats::PHASE_UPDATE);
+
+			clock.advance(config.step);
+			if(!player.step(*camera))
+			{
+				player.start(config.step);
+				player.step(*camera);
+			}
+			snapshot->publish(*camera);
+
+			if(config.threaded)
+			{
+				renderThread.post(RenderCommand::setTime(clock.getTime()));
+				renderThread.post(RenderCommand::camera());
+				renderThread.requestFrame();
+			}
+		}
+		double updateMs = updateTimer.milliseconds();
+
+		// one frame in flight at most, like a blocking present
+		if(config.threaded)
+		{
+			while(renderThread.framesRendered() <= frame)
+			{
+				Thread::yield();
+			}
+		}
+		else
+		{
+			renderer.renderSetTime(clock.getTime());
+			renderer.renderLatchCamera();
+			renderer.renderFrame();
+		}
+
+		if(frame >= config.warmup)
+		{
+			updateTimes.push_back((float)updateMs);
+			frameTimes.push_back((float)frameTimer.milliseconds());
+		}
+	}
+
+	double wallSeconds = wallTimer.seconds();
+	double cpuSeconds = processCpuSeconds() - cpuStart;
+	int allocations = g_allocations.load() - allocationsStart;
+	int frees = g_frees.load() - freesStart;
+
+	renderThread.stop();
+
+	FILE *fp = config.output ? fopen(config.output, "w") : stdout;
+	if(!fp)
+	{
+		fprintf(stderr, "QtDXBenchmark: cannot write '%s'\n", config.output);
+		return 1;
+	}
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "\t\"benchmark\": \"QtDXBenchmark\",\n");
+	fprintf(fp, "\t\"config\": { \"frames\": %d, \"warmup\": %d, \"step\": %.6f, \"objects\": %d, \"width\": %u, \"height\": %u, \"threaded\": %s, \"track\": \"%s\" },\n",
+		config.frames, config.warmup, config.step, config.objects, config.width, config.height,
+		config.threaded ? "true" : "false", config.track ? "file" : "orbit");
+	fprintf(fp, "\t\"wall_seconds\": %.6f,\n", wallSeconds);
+	fprintf(fp, "\t\"cpu_seconds\": %.6f,\n", cpuSeconds);
+	fprintf(fp, "\t\"cpu_utilization\": %.4f,\n", wallSeconds > 0.0 ? cpuSeconds / wallSeconds : 0.0);
+	fprintf(fp, "\t\"allocations\": { \"count\": %d, \"frees\": %d, \"per_frame\": %.4f },\n",
+		allocations, frees, (double)allocations / config.frames);
+	fprintf(fp, "\t\"visible_per_frame\": %.2f,\n", (double)renderer.visibleTotal() / config.frames);
+	fprintf(fp, "\t\"checksum\": %.6f,\n", renderer.checksum());
+	writeSummary(fp, "frame_ms", frameTimes, false);
+	writeSummary(fp, "update_ms", updateTimes, false);
+	writeSummary(fp, "render_ms", renderer.renderTimes(), true);
+	fprintf(fp, "}\n");
+
+	if(fp != stdout) fclose(fp);
+
+	delete snapshot;
+	btAlignedFree(camera);
+	return 0;
+}
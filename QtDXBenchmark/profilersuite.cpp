@@ -0,0 +1,67 @@
+/*!
+	@brief Cost of profiler zones and counters
+	@author Shintaro Takemura
+*/
+
+#include "suites.h"
+#include "../common/profiler.h"
+
+namespace
+{
+	//! Stands in for the work inside a zone, so the loop is not optimized away
+	volatile int s_work;
+}
+
+/*!
+	One ProfileZone per iteration, its begin and end event, against the same
+	loop without it; the counter loop records one PROFILE_COUNTER sample.
+	ProfileZone and Profiler::mark are used directly, so the suite measures
+	the profiler whether or not USE_PROFILER is defined for the benchmark.
+	"readticks_ns" is one timestamp; a zone takes two.
+*/
+void runProfilerSuite(SuiteResults &results)
+{
+	const int ZONES = 20000000;
+
+	// attach the thread's buffer before timing
+	{
+		ProfileZone zone("warm up");
+	}
+
+	HighResolutionTimer timer;
+	for(int n=0; n<ZONES; ++n)
+	{
+		s_work = n;
+	}
+	double baseline = nanosecondsPer(timer.seconds(), ZONES);
+
+	timer.reset();
+	for(int n=0; n<ZONES; ++n)
+	{
+		ProfileZone zone("zone");
+		s_work = n;
+	}
+	double zone = nanosecondsPer(timer.seconds(), ZONES);
+
+	timer.reset();
+	for(int n=0; n<ZONES; ++n)
+	{
+		Profiler::mark(Profiler::EVENT_COUNTER, "counter", (double)n);
+		s_work = n;
+	}
+	double counter = nanosecondsPer(timer.seconds(), ZONES);
+
+	volatile long long ticks = 0;
+	timer.reset();
+	for(int n=0; n<ZONES; ++n)
+	{
+		ticks = LogStamp::readTicks();
+	}
+	double readTicks = nanosecondsPer(timer.seconds(), ZONES);
+	(void)ticks;
+
+	addResult(results, "baseline_loop_ns", baseline, "ns");
+	addResult(results, "zone_ns", zone - baseline, "ns");
+	addResult(results, "counter_ns", counter - baseline, "ns");
+	addResult(results, "readticks_ns", readTicks, "ns");
+}
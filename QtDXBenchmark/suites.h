@@ -0,0 +1,67 @@
+/*!
+	@brief Micro benchmark suites run with QtDXBenchmark -suite name
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/timer.h"
+#include "../common/framestats.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//! One measured quantity of a suite
+struct SuiteResult
+{
+	std::string	name;
+	double		value;
+	const char*	unit;
+};
+
+typedef std::vector<SuiteResult> SuiteResults;
+
+inline void addResult(SuiteResults &results, const std::string &name, double value, const char *unit)
+{
+	SuiteResult result;
+	result.name = name;
+	result.value = value;
+	result.unit = unit;
+	results.push_back(result);
+	printf("%-40s %12.2f %s\n", name.c_str(), value, unit);
+}
+
+//! Nearest-rank percentiles and the mean of 'samples' (main.cpp)
+FrameStats::Summary summarize(std::vector<float> samples, double &mean);
+
+//! mean, p50, p99 and max of per-operation samples as name_mean, name_p50...
+inline void addSummary(SuiteResults &results, const std::string &name, const std::vector<float> &samples, const char *unit)
+{
+	double mean;
+	FrameStats::Summary summary = summarize(samples, mean);
+	addResult(results, name + "_mean", mean, unit);
+	addResult(results, name + "_p50", summary.p50, unit);
+	addResult(results, name + "_p99", summary.p99, unit);
+	addResult(results, name + "_max", summary.max, unit);
+}
+
+//! Nanoseconds per operation for 'count' operations that took 'seconds'
+inline double nanosecondsPer(double seconds, long long count)
+{
+	return seconds * 1.0e9 / (double)count;
+}
+
+// camerasuite.cpp
+void runCameraSuite(SuiteResults &results);
+
+// logsuite.cpp
+void runLogSinkSuite(SuiteResults &results);
+void runLogLevelSuite(SuiteResults &results);
+void runLogContentionSuite(SuiteResults &results);
+void runLogStampSuite(SuiteResults &results);
+void runBinaryLogSuite(SuiteResults &results);
+
+// profilersuite.cpp
+void runProfilerSuite(SuiteResults &results);
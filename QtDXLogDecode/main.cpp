@@ -0,0 +1,86 @@
+/*!
+	@brief Offline decoder for BinaryLog::OUTPUT_BINARY files
+	@author Shintaro Takemura
+
+	Writes the lines the logger would have formatted itself. The log has to
+	come from a build with the same pointer size and byte order.
+
+	Linux:
+		g++ -std=c++03 -O2 -msse2 main.cpp -o QtDXLogDecode -lpthread
+
+	Usage:
+		QtDXLogDecode input.binlog [output.txt]
+*/
+
+#include "../common/common.h"
+#include "../common/binarylog.h"
+
+#include <cstdio>
+#include <string>
+
+static FILE* openFile(const char *fileName, const char *mode)
+{
+#ifdef _MSC_VER
+	FILE *fp = NULL;
+	if(fopen_s(&fp, fileName, mode) != 0) return NULL;
+	return fp;
+#else
+	return fopen(fileName, mode);
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+	if(argc < 2 || argc > 3)
+	{
+		fprintf(stderr, "usage: QtDXLogDecode input.binlog [output.txt]\n");
+		return 2;
+	}
+
+	FILE *in = openFile(argv[1], "rb");
+	if(!in)
+	{
+		fprintf(stderr, "QtDXLogDecode: cannot read '%s'\n", argv[1]);
+		return 1;
+	}
+
+	FILE *out = stdout;
+	if(argc == 3)
+	{
+		out = openFile(argv[2], "w");
+		if(!out)
+		{
+			fprintf(stderr, "QtDXLogDecode: cannot write '%s'\n", argv[2]);
+			fclose(in);
+			return 1;
+		}
+	}
+
+	BinaryLogDecoder decoder;
+	std::string text;
+	char buffer[64 * 1024];
+	bool valid = true;
+	size_t size;
+	while(valid && (size = fread(buffer, 1, sizeof(buffer), in)) > 0)
+	{
+		valid = decoder.decode(buffer, size, text);
+		fwrite(text.data(), 1, text.size(), out);
+		text.clear();
+	}
+	fclose(in);
+
+	int result = 0;
+	if(!valid)
+	{
+		fprintf(stderr, "QtDXLogDecode: '%s' is not a binary log of this build\n", argv[1]);
+		result = 1;
+	}
+	else if(!decoder.complete())
+	{
+		// the logger was killed in the middle of a write
+		fprintf(stderr, "QtDXLogDecode: '%s' ends in a truncated record\n", argv[1]);
+	}
+
+	if(out != stdout && fclose(out) != 0) result = 1;
+	return result;
+}
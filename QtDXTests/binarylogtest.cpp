@@ -0,0 +1,258 @@
+/*!
+	@brief BinaryLog capture, formatting and the BINLOG_xxx macros
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/binarylog.h"
+
+#include <string>
+
+namespace
+{
+	//! Collects what the writer thread hands over; read it after BinaryLog::flush()
+	class CaptureLogSink : public LogSink
+	{
+	public:
+		virtual void	write(int level, const char *text, size_t size)
+		{
+			(void)level;
+			m_text.append(text, size);
+		}
+
+		std::string	m_text;
+	};
+
+	int s_evaluated;
+
+	int counted(int value)
+	{
+		++s_evaluated;
+		return value;
+	}
+
+	void appendChunk(std::string &out, unsigned int type, const void *data, size_t size)
+	{
+		BinaryLogChunk chunk = { type, (unsigned int)size };
+		out.append((const char*)&chunk, sizeof(chunk));
+		out.append((const char*)data, size);
+	}
+}
+
+//! The macros log through the named logger and skip their arguments below its level
+void testBinaryLogMacros()
+{
+	CaptureLogSink sink;
+	BinaryLog binlog(&sink);
+	binlog.setLevel(logging<char>::INFO);
+
+	s_evaluated = 0;
+	BINLOG_INFO(binlog, "frame %d: %.2f %s", 42, 1.5f, "ok");
+	BINLOG_WARN(binlog, "%5u|%-4x|%c", 7u, 255, 'z');
+	BINLOG_ERROR(binlog, "no arguments");
+	BINLOG_DEBUG(binlog, "filtered %d", counted(1));
+	BINLOG_FATAL(binlog, "%d%%", counted(100));
+	binlog.flush();
+
+	CHECK(sink.m_text.find("frame 42: 1.50 ok\n") != std::string::npos);
+	CHECK(sink.m_text.find("    7|ff  |z\n") != std::string::npos);
+	CHECK(sink.m_text.find("no arguments\n") != std::string::npos);
+	CHECK(sink.m_text.find("filtered") == std::string::npos);
+	CHECK(sink.m_text.find("100%\n") != std::string::npos);
+	CHECK(s_evaluated == 1);
+	CHECK(binlog.dropped() == 0);
+
+	// every line starts with "hh:mm:ss.uuuuuu [thread] "
+	CHECK(sink.m_text.size() > 16 && sink.m_text[2] == ':' && sink.m_text[8] == '.' && sink.m_text[16] == '[');
+}
+
+//! A thread logging to many loggers in turn keeps one buffer per logger, also after loggers were replaced
+void testBinaryLogThreadBuffers()
+{
+	enum { LOGGERS = 8 };
+
+	CaptureLogSink sinks[LOGGERS];
+	BinaryLog *loggers[LOGGERS];
+	for(int i=0; i<LOGGERS; ++i)
+	{
+		loggers[i] = new BinaryLog(&sinks[i]);
+	}
+
+	for(int round=0; round<100; ++round)
+	{
+		for(int i=0; i<LOGGERS; ++i)
+		{
+			loggers[i]->log(logging<char>::INFO, "round %d", round);
+		}
+	}
+	for(int i=0; i<LOGGERS; ++i)
+	{
+		loggers[i]->flush();
+		CHECK(loggers[i]->threadCount() == 1);
+		CHECK(loggers[i]->dropped() == 0);
+		CHECK(sinks[i].m_text.find("round 99\n") != std::string::npos);
+	}
+
+	// more loggers than slots over time; each new one reuses a slot and attaches a fresh buffer
+	for(int n=0; n<BinaryLog::MAX_LOGGERS * 2; ++n)
+	{
+		delete loggers[n % LOGGERS];
+		sinks[n % LOGGERS].m_text.clear();
+		loggers[n % LOGGERS] = new BinaryLog(&sinks[n % LOGGERS]);
+		loggers[n % LOGGERS]->log(logging<char>::INFO, "logger %d", n);
+		loggers[n % LOGGERS]->flush();
+		CHECK(loggers[n % LOGGERS]->threadCount() == 1);
+		CHECK(loggers[n % LOGGERS]->dropped() == 0);
+	}
+	for(int i=0; i<LOGGERS; ++i)
+	{
+		delete loggers[i];
+	}
+}
+
+namespace
+{
+	//! Logs COUNT numbered lines, yielding now and then so the threads interleave
+	class BinaryLogProducer : public Thread
+	{
+	public:
+		enum { COUNT = 1000 };
+
+		explicit BinaryLogProducer(BinaryLog &binlog) : m_binlog(binlog) {}
+
+	protected:
+		virtual void run()
+		{
+			for(int n=0; n<COUNT; ++n)
+			{
+				m_binlog.log(logging<char>::INFO, "line %d", n);
+				if(n % 64 == 0) Thread::yield();
+			}
+		}
+
+		BinaryLog&	m_binlog;
+	};
+}
+
+//! Lines of several threads reach the sink with non-decreasing times
+void testBinaryLogTimeOrder()
+{
+	enum { THREADS = 4 };
+
+	CaptureLogSink sink;
+	BinaryLog binlog(&sink, 1);
+
+	BinaryLogProducer *producers[THREADS];
+	for(int n=0; n<THREADS; ++n)
+	{
+		producers[n] = new BinaryLogProducer(binlog);
+		producers[n]->start();
+	}
+	for(int n=0; n<THREADS; ++n)
+	{
+		producers[n]->join();
+		delete producers[n];
+	}
+	binlog.flush();
+
+	int lines = 0;
+	int backwards = 0;
+	std::string last;
+	for(size_t begin=0; begin<sink.m_text.size(); ++lines)
+	{
+		size_t end = sink.m_text.find('\n', begin);
+		if(end == std::string::npos) break;
+
+		// "hh:mm:ss.uuuuuu" compares as text
+		std::string time = sink.m_text.substr(begin, 15);
+		if(time < last) ++backwards;
+		last = time;
+		begin = end + 1;
+	}
+
+	CHECK(binlog.dropped() == 0);
+	CHECK(lines == THREADS * BinaryLogProducer::COUNT);
+	CHECK(backwards == 0);
+}
+
+//! A binary log decodes to the lines the text output has, also when fed in small pieces
+void testBinaryLogDecode()
+{
+	CaptureLogSink textSink;
+	CaptureLogSink binarySink;
+	{
+		BinaryLog text(&textSink);
+		BinaryLog binary(&binarySink, 50, BinaryLog::OUTPUT_BINARY);
+		std::string name("camera");
+		for(int n=0; n<100; ++n)
+		{
+			text.log(logging<char>::INFO, "%s %d at %.3f %p", name, n, n * 0.25, (void*)&name);
+			binary.log(logging<char>::INFO, "%s %d at %.3f %p", name, n, n * 0.25, (void*)&name);
+			if(n % 10 == 0)
+			{
+				text.log(logging<char>::WARN, "%5.1f%%", 12.25);
+				binary.log(logging<char>::WARN, "%5.1f%%", 12.25);
+			}
+		}
+	}
+
+	BinaryLogDecoder decoder;
+	std::string decoded;
+	for(size_t n=0; n<binarySink.m_text.size(); n+=7)
+	{
+		size_t size = std::min((size_t)7, binarySink.m_text.size() - n);
+		CHECK(decoder.decode(binarySink.m_text.data() + n, size, decoded));
+	}
+	CHECK(decoder.complete());
+	CHECK(binarySink.m_text.find("camera") != std::string::npos);
+	CHECK(binarySink.m_text.find("12.2") == std::string::npos);
+
+	// the same lines apart from the times
+	size_t t = 0;
+	size_t d = 0;
+	int lines = 0;
+	while(t < textSink.m_text.size() && d < decoded.size())
+	{
+		size_t textEnd = textSink.m_text.find('\n', t);
+		size_t decodedEnd = decoded.find('\n', d);
+		if(textEnd == std::string::npos || decodedEnd == std::string::npos) break;
+
+		CHECK(decoded[d + 2] == ':' && decoded[d + 8] == '.' && decoded[d + 16] == '[');
+		CHECK(textSink.m_text.compare(t + 15, textEnd - t - 15, decoded, d + 15, decodedEnd - d - 15) == 0);
+		t = textEnd + 1;
+		d = decodedEnd + 1;
+		++lines;
+	}
+	CHECK(lines == 110);
+	CHECK(t == textSink.m_text.size() && d == decoded.size());
+
+	BinaryLogDecoder garbage;
+	CHECK(!garbage.decode(textSink.m_text.data(), textSink.m_text.size(), decoded));
+
+	// a corrupt record claims three arguments and a string longer than itself;
+	// the arguments that do not fit stay unformatted instead of being read past the record
+	std::string corrupt;
+	BinaryLogHeader header = { { 'Q', 'T', 'D', 'X', 'B', 'L', 'O', 'G' }, BinaryLogHeader::VERSION, sizeof(void*) };
+	appendChunk(corrupt, BinaryLogChunk::HEADER, &header, sizeof(header));
+
+	unsigned long long id = 1;
+	std::string formatChunk((const char*)&id, sizeof(id));
+	formatChunk += "%d %s %s";
+	appendChunk(corrupt, BinaryLogChunk::FORMAT, formatChunk.data(), formatChunk.size());
+
+	long long storage[8] = { 0 };
+	BinaryLogRecord *record = (BinaryLogRecord*)storage;
+	char *p = BinaryLogArg<int>::store((char*)(record + 1), 7);
+	*p++ = (char)BINLOG_TAG_STRING;
+	*p++ = (char)200;
+	*p++ = 'a';
+	record->size = (unsigned int)((p - (char*)record + 7) & ~7);
+	record->argCount = 3;
+	record->format = (const char*)(size_t)id;
+	appendChunk(corrupt, BinaryLogChunk::RECORD, record, record->size);
+
+	BinaryLogDecoder corruptDecoder;
+	std::string corruptLine;
+	CHECK(corruptDecoder.decode(corrupt.data(), corrupt.size(), corruptLine));
+	CHECK(corruptLine.size() > 15 && corruptLine.compare(corruptLine.size() - 8, 8, "7 %s %s\n") == 0);
+}
@@ -0,0 +1,134 @@
+/*!
+	@brief CameraSnapshotBuffer under a writer and concurrent readers
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/camerasnapshot.h"
+#include "../common/thread.h"
+#include "../common/timer.h"
+
+namespace
+{
+	enum
+	{
+		READERS = 3,
+		PUBLISHES = 16000000,	// below 2^24, every count is exact as a float
+	};
+
+	//! Publishes cameras whose every field holds the publish number
+	class SnapshotWriter : public Thread
+	{
+	public:
+		explicit SnapshotWriter(CameraSnapshotBuffer &buffer) : m_buffer(buffer) {}
+
+	protected:
+		virtual void run()
+		{
+			Camera camera;
+			for(int n=1; n<=PUBLISHES; ++n)
+			{
+				float value = (float)n;
+				vmVector4 row(value);
+				camera.m_viewMatrix = vmMatrix4(row, row, row, row);
+				camera.m_projMatrix = vmMatrix4(-row, -row, -row, -row);
+				camera.m_eye = vmVector3(value);
+				camera.m_fovx = value;
+				camera.m_aspect = value;
+				camera.m_znear = value;
+				camera.m_zfar = value;
+				m_buffer.publish(camera);
+			}
+		}
+
+		CameraSnapshotBuffer&	m_buffer;
+	};
+
+	//! Reads until the last publish and counts snapshots mixing two publishes
+	class SnapshotReader : public Thread
+	{
+	public:
+		explicit SnapshotReader(const CameraSnapshotBuffer &buffer) :
+			m_reads(0),
+			m_torn(0),
+			m_backwards(0),
+			m_buffer(buffer)
+		{
+		}
+
+		int	m_reads;
+		int	m_torn;
+		int	m_backwards;
+
+	protected:
+		virtual void run()
+		{
+			CameraSnapshot snapshot;
+			unsigned int last = 0;
+			do
+			{
+				m_buffer.read(snapshot);
+				++m_reads;
+
+				if(snapshot.version < last) ++m_backwards;
+				last = snapshot.version;
+				if(snapshot.version == 0) continue;
+
+				if(!consistent(snapshot)) ++m_torn;
+			}
+			while(last < PUBLISHES);
+		}
+
+		static bool consistent(const CameraSnapshot &snapshot)
+		{
+			float value = (float)snapshot.version;
+			for(int c=0; c<4; ++c)
+			{
+				for(int r=0; r<4; ++r)
+				{
+					if(snapshot.viewMatrix.getElem(c, r) != value) return false;
+					if(snapshot.projMatrix.getElem(c, r) != -value) return false;
+				}
+			}
+			for(int i=0; i<3; ++i)
+			{
+				if(snapshot.eye[i] != value) return false;
+			}
+			return snapshot.fovx == value && snapshot.aspect == value &&
+				snapshot.znear == value && snapshot.zfar == value;
+		}
+
+		const CameraSnapshotBuffer&	m_buffer;
+	};
+}
+
+//! No reader ever sees a snapshot mixing two publishes, and versions never go back
+void testSnapshotNotTorn()
+{
+	CameraSnapshotBuffer *buffer = new CameraSnapshotBuffer;
+
+	SnapshotReader *readers[READERS];
+	for(int n=0; n<READERS; ++n)
+	{
+		readers[n] = new SnapshotReader(*buffer);
+		readers[n]->start();
+	}
+
+	SnapshotWriter writer(*buffer);
+	writer.start();
+	writer.join();
+
+	int reads = 0;
+	for(int n=0; n<READERS; ++n)
+	{
+		readers[n]->join();
+		reads += readers[n]->m_reads;
+		CHECK(readers[n]->m_torn == 0);
+		CHECK(readers[n]->m_backwards == 0);
+		delete readers[n];
+	}
+
+	CHECK(reads > 0);
+	CHECK(buffer->version() == PUBLISHES);
+	delete buffer;
+}
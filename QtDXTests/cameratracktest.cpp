@@ -0,0 +1,56 @@
+/*!
+	@brief CameraTrack files
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/cameratrack.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace
+{
+	const char *TRACK_FILE = "QtDXTests_track.ctrk";
+}
+
+//! A saved track loads back; a header claiming more keys than the file holds is refused before allocating
+void testCameraTrackLoad()
+{
+	CameraTrack track;
+	for(int n=0; n<3; ++n)
+	{
+		CameraTrackKey key;
+		memset(&key, 0, sizeof(key));
+		key.time = (float)n;
+		key.centerOfInterest = 10.0f + n;
+		track.push_back(key);
+	}
+	CHECK(track.save(TRACK_FILE));
+
+	CameraTrack loaded;
+	CHECK(loaded.load(TRACK_FILE));
+	CHECK(loaded.size() == 3 && loaded[2].centerOfInterest == 12.0f);
+
+	// the same header with a huge key count and only the three keys behind it
+	CameraTrack::FileHeader header;
+	header.magic = CameraTrack::FILE_MAGIC;
+	header.version = CameraTrack::FILE_VERSION;
+	header.keyCount = 0xffffffffu;
+	header.keySize = sizeof(CameraTrackKey);
+	{
+		std::ofstream ofs(TRACK_FILE, std::ios::out | std::ios::binary | std::ios::trunc);
+		ofs.write((const char*)&header, sizeof(header));
+		for(size_t n=0; n<track.size(); ++n)
+		{
+			ofs.write((const char*)&track[n], sizeof(CameraTrackKey));
+		}
+	}
+
+	int before = allocationCount();
+	CHECK(!loaded.load(TRACK_FILE));
+	CHECK(allocationCount() - before < 8);
+	CHECK(loaded.size() == 3);
+
+	remove(TRACK_FILE);
+}
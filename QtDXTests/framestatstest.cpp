@@ -0,0 +1,41 @@
+/*!
+	@brief FrameStats phase accounting
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/framestats.h"
+#include "../common/timer.h"
+
+namespace
+{
+	void spin(double milliseconds)
+	{
+		HighResolutionTimer timer;
+		while(timer.milliseconds() < milliseconds) {}
+	}
+}
+
+//! Presents inside a render scope come out of it, presents outside of one do not
+void testFrameStatsPresentInRender()
+{
+	FrameStats stats;
+
+	// render() called from onResize: a present without a render scope
+	stats.record(FrameStats::PHASE_PRESENT, 5.0);
+
+	{
+		FrameStats::Scope renderScope(stats, FrameStats::PHASE_RENDER);
+		spin(2.0);
+	}
+	CHECK(stats.summarize(FrameStats::PHASE_RENDER).max >= 1.9);
+
+	{
+		FrameStats::Scope renderScope(stats, FrameStats::PHASE_RENDER);
+		spin(2.0);
+		stats.record(FrameStats::PHASE_PRESENT, 1.5);
+	}
+	CHECK(stats.summarize(FrameStats::PHASE_RENDER).p50 < 1.0);
+	CHECK(stats.count(FrameStats::PHASE_RENDER) == 2);
+	CHECK(stats.count(FrameStats::PHASE_PRESENT) == 2);
+}
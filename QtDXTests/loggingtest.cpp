@@ -0,0 +1,105 @@
+/*!
+	@brief The shared logger's streaming and printf paths
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/logging.h"
+
+#include <cstring>
+#include <ostream>
+
+namespace
+{
+	//! Keeps the last record in a fixed buffer, so the sink itself never allocates
+	class LastRecordLogSink : public LogSink
+	{
+	public:
+		LastRecordLogSink() : m_records(0)
+		{
+			m_last[0] = 0;
+		}
+
+		virtual void	write(int level, const char *text, size_t size)
+		{
+			(void)level;
+			size = std::min(size, sizeof(m_last) - 1);
+			memcpy(m_last, text, size);
+			m_last[size] = 0;
+			++m_records;
+		}
+
+		int		m_records;
+		char	m_last[2048];
+	};
+}
+
+//! Streaming and formatting enabled records reaches the sink without a heap allocation
+void testLoggingNoAllocations()
+{
+	LastRecordLogSink sink;
+	logger.setSink(&sink);
+	logger.setLevel(logging<char>::INFO);
+
+	// the first numeric output may set up locale caches
+	logger.info << "warm up " << 1 << ' ' << 1.5f << std::endl;
+
+	int before = allocationCount();
+	for(int n=0; n<1000; ++n)
+	{
+		logger.info << "frame " << n << ": " << 0.25 * n << ' ' << (void*)0 << std::endl;
+		LOG_STREAM(logger, warn) << "stream " << n << std::endl;
+		LOG_STREAM(logger, debug) << "filtered " << n << std::endl;
+		logger.info("printf %d %s\n", n, "path");
+	}
+	int allocations = allocationCount() - before;
+
+	CHECK(allocations == 0);
+	CHECK(sink.m_records == 1 + 3 * 1000);
+	CHECK(strcmp(sink.m_last, "printf 999 path\n") == 0);
+
+	// a line longer than the staging buffer is cut, not grown, and keeps its line break
+	typedef logging<char>::log_stringbuf<logging<char>::INFO> InfoBuffer;
+	InfoBuffer *buffer = static_cast<InfoBuffer*>(logger.info.rdbuf());
+	unsigned int truncated = buffer->getTruncated();
+
+	before = allocationCount();
+	for(int n=0; n<logging<char>::STAGING + 100; ++n)
+	{
+		logger.info << 'x';
+	}
+	logger.info << std::endl;
+	allocations = allocationCount() - before;
+
+	CHECK(allocations == 0);
+	CHECK(strlen(sink.m_last) == logging<char>::STAGING - 1);
+	CHECK(sink.m_last[logging<char>::STAGING - 2] == '\n');
+	CHECK(buffer->getTruncated() - truncated == 100 + 2);
+
+	// the next line starts with a whole buffer again
+	logger.info << "after" << std::endl;
+	CHECK(strcmp(sink.m_last, "after\n") == 0);
+
+	logger.setSink(0);
+}
+
+//! LOG_CHANGED logs a state once and reports the repeats with the next change, for keys wider than 32 bits too
+void testLoggingChanged()
+{
+	LastRecordLogSink sink;
+	logger.setSink(&sink);
+	logger.setLevel(logging<char>::INFO);
+
+	const long long keys[] = { 0, 0, 1LL << 32, 1LL << 32, 1LL << 32, 0 };
+	for(size_t n=0; n<sizeof(keys) / sizeof(keys[0]); ++n)
+	{
+		LOG_CHANGED(logger, info, keys[n], "key %lld\n", keys[n]);
+		if(n == 2) CHECK(sink.m_records == 1 && strcmp(sink.m_last, "key 4294967296\n") == 0);
+	}
+
+	// the two repeats of 1 << 32 as a summary line, then the change back to 0
+	CHECK(sink.m_records == 3);
+	CHECK(strcmp(sink.m_last, "key 0\n") == 0);
+
+	logger.setSink(0);
+}
@@ -0,0 +1,88 @@
+/*!
+	@brief MappedLogSink file rotation
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/logsink.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace
+{
+	const char *LOG_FILE = "QtDXTests_mapped.log";
+	const char *BACKUP_FILE = "QtDXTests_mapped.log.1";
+
+	long fileSize(const char *name)
+	{
+		std::ifstream ifs(name, std::ios::in | std::ios::binary | std::ios::ate);
+		return ifs ? (long)ifs.tellg() : -1;
+	}
+
+	void makeDirectory(const char *name)
+	{
+#ifdef _WIN32
+		_mkdir(name);
+#else
+		mkdir(name, 0755);
+#endif
+	}
+
+	void removeDirectory(const char *name)
+	{
+#ifdef _WIN32
+		_rmdir(name);
+#else
+		rmdir(name);
+#endif
+	}
+}
+
+//! A full file becomes the backup; one that cannot be moved aside is started over instead of rotated again
+void testMappedLogSinkRotation()
+{
+	remove(LOG_FILE);
+	remove(BACKUP_FILE);
+
+	char line[64];
+	memset(line, 'x', sizeof(line) - 1);
+	line[sizeof(line) - 1] = '\n';
+
+	{
+		MappedLogSink sink;
+		CHECK(sink.open(LOG_FILE, 4096, 1));
+		for(int n=0; n<100; ++n)
+		{
+			sink.write(20, line, sizeof(line));
+		}
+		CHECK(sink.rotations() == 1);
+	}
+	CHECK(fileSize(BACKUP_FILE) == 4096);
+	CHECK(fileSize(LOG_FILE) == 36 * (long)sizeof(line));
+
+	// a directory in place of the backup makes the rename fail; the file is already over the size
+	remove(BACKUP_FILE);
+	makeDirectory(BACKUP_FILE);
+	{
+		std::ofstream ofs(LOG_FILE, std::ios::out | std::ios::binary | std::ios::trunc);
+		std::string full(5000, 'y');
+		ofs.write(full.data(), full.size());
+	}
+	{
+		MappedLogSink sink;
+		CHECK(sink.open(LOG_FILE, 4096, 1));
+		CHECK(sink.rotations() == 1);
+		sink.write(20, "after\n", 6);
+	}
+	CHECK(fileSize(LOG_FILE) == 6);
+
+	removeDirectory(BACKUP_FILE);
+	remove(LOG_FILE);
+}
@@ -0,0 +1,48 @@
+/*!
+	@brief LogClock calibration
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/logstamp.h"
+#include "../common/thread.h"
+#include "../common/timer.h"
+
+//! Creating a clock does not wait; the first calibrate() measures a rate that converts ticks to seconds
+void testLogClockLazyCalibration()
+{
+	enum { CLOCKS = 20 };
+
+	HighResolutionTimer timer;
+	LogClock *clocks[CLOCKS];
+	for(int n=0; n<CLOCKS; ++n)
+	{
+		clocks[n] = new LogClock;
+	}
+	double created = timer.seconds();
+
+	// a millisecond each used to be spent here
+	CHECK(created < CLOCKS * 0.0005);
+	CHECK(clocks[0]->getFrequency() == 0.0);
+
+	while(timer.seconds() < 0.02)
+	{
+		Thread::yield();
+	}
+	clocks[0]->calibrate();
+	CHECK(clocks[0]->getFrequency() > 0.0);
+
+	// at least 20 ms since creation, measured with the clock's own rate
+	double elapsed = clocks[0]->elapsed(LogStamp::readTicks());
+	CHECK(elapsed > 0.015 && elapsed < 1.0);
+
+	char text[LogClock::TEXT_SIZE];
+	int length = clocks[1]->format(LogStamp::readTicks(), 7, text);
+	CHECK(length == 20 && text[2] == ':' && text[8] == '.' && text[16] == '[');
+	CHECK(clocks[1]->getFrequency() > 0.0);
+
+	for(int n=0; n<CLOCKS; ++n)
+	{
+		delete clocks[n];
+	}
+}
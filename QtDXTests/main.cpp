@@ -0,0 +1,122 @@
+/*!
+	@brief Unit and stress tests for the code under common/, without Qt or a GPU
+	@author Shintaro Takemura
+
+	Linux:
+		g++ -std=c++03 -O2 -msse2 *.cpp -o QtDXTests -lpthread
+
+	Usage:
+		QtDXTests [name...]
+
+	Runs every test, or those whose name contains one of the arguments.
+	Exits with 1 if any check failed.
+*/
+
+#include "tests.h"
+#include "../common/timer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+//! Global heap traffic; aligned vectormath allocations go through btAlignedAlloc and are not counted
+static AtomicInt g_allocations;
+
+void* operator new(size_t size) throw(std::bad_alloc)
+{
+	g_allocations.fetchAdd(1);
+	void *p = malloc(size ? size : 1);
+	if(!p) throw std::bad_alloc();
+	return p;
+}
+
+void* operator new[](size_t size) throw(std::bad_alloc)
+{
+	g_allocations.fetchAdd(1);
+	void *p = malloc(size ? size : 1);
+	if(!p) throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void *p) throw()
+{
+	free(p);
+}
+
+void operator delete[](void *p) throw()
+{
+	free(p);
+}
+
+int allocationCount()
+{
+	return g_allocations.load();
+}
+
+static int g_failures;
+
+void checkFailed(const char *expr, const char *file, int line)
+{
+	printf("  %s(%d): CHECK(%s) failed\n", file, line, expr);
+	++g_failures;
+}
+
+struct TestCase
+{
+	const char*	name;
+	void		(*function)();
+};
+
+static const TestCase s_tests[] =
+{
+	{ "BinaryLogMacros",	testBinaryLogMacros },
+	{ "BinaryLogThreadBuffers",	testBinaryLogThreadBuffers },
+	{ "BinaryLogTimeOrder",	testBinaryLogTimeOrder },
+	{ "BinaryLogDecode",	testBinaryLogDecode },
+	{ "CameraTrackLoad",	testCameraTrackLoad },
+	{ "SnapshotNotTorn",	testSnapshotNotTorn },
+	{ "FrameStatsPresentInRender",	testFrameStatsPresentInRender },
+	{ "LoggingNoAllocations",	testLoggingNoAllocations },
+	{ "LoggingChanged",	testLoggingChanged },
+	{ "MappedLogSinkRotation",	testMappedLogSinkRotation },
+	{ "LogClockLazyCalibration",	testLogClockLazyCalibration },
+	{ "ProfileBufferCopy",	testProfileBufferCopy },
+	{ "RenderThreadQueue",	testRenderThreadQueue },
+	{ "RenderThreadFrames",	testRenderThreadFrames },
+	{ "ResizePolicyDebounce",	testResizePolicyDebounce },
+};
+
+static bool selected(const char *name, int argc, char *argv[])
+{
+	if(argc < 2) return true;
+	for(int n=1; n<argc; ++n)
+	{
+		if(strstr(name, argv[n])) return true;
+	}
+	return false;
+}
+
+int main(int argc, char *argv[])
+{
+	int run = 0;
+	int failed = 0;
+	for(size_t n=0; n<sizeof(s_tests) / sizeof(s_tests[0]); ++n)
+	{
+		const TestCase &test = s_tests[n];
+		if(!selected(test.name, argc, argv)) continue;
+
+		int failures = g_failures;
+		long long start = HighResolutionTimer::ticks();
+		test.function();
+		double ms = (double)(HighResolutionTimer::ticks() - start) * 1000.0 / (double)HighResolutionTimer::frequency();
+
+		bool passed = (g_failures == failures);
+		printf("%s %s (%.1f ms)\n", passed ? "[ OK ]" : "[FAIL]", test.name, ms);
+		++run;
+		if(!passed) ++failed;
+	}
+
+	printf("%d of %d tests passed\n", run - failed, run);
+	return failed ? 1 : 0;
+}
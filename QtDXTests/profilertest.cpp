@@ -0,0 +1,44 @@
+/*!
+	@brief ProfileBuffer ring copies
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/profiler.h"
+
+#include <vector>
+
+//! A copy holds the newest events in order and never the slot the owner writes next
+void testProfileBufferCopy()
+{
+	ProfileBuffer *buffer = new ProfileBuffer;
+	std::vector<ProfileEvent> events;
+
+	for(int n=0; n<10; ++n)
+	{
+		buffer->push(Profiler::EVENT_COUNTER, "counter", (double)n);
+	}
+	buffer->copy(events);
+	CHECK(events.size() == 10);
+	CHECK(events.front().value == 0.0 && events.back().value == 9.0);
+
+	// wrapped: the oldest remaining slot is the next one to be overwritten
+	int pushes = ProfileBuffer::CAPACITY + 100;
+	for(int n=10; n<pushes; ++n)
+	{
+		buffer->push(Profiler::EVENT_COUNTER, "counter", (double)n);
+	}
+	buffer->copy(events);
+	CHECK(events.size() == ProfileBuffer::CAPACITY - 1);
+	CHECK(events.front().value == (double)(pushes - ProfileBuffer::CAPACITY + 1));
+	CHECK(events.back().value == (double)(pushes - 1));
+
+	bool ordered = true;
+	for(size_t n=1; n<events.size(); ++n)
+	{
+		if(events[n].value != events[n - 1].value + 1.0) ordered = false;
+	}
+	CHECK(ordered);
+
+	delete buffer;
+}
@@ -0,0 +1,129 @@
+/*!
+	@brief RenderThread command queue driven with a null backend
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/renderthread.h"
+
+#include <vector>
+
+namespace
+{
+	//! Records what arrives instead of rendering
+	class NullBackend : public RenderBackend
+	{
+	public:
+		NullBackend() :
+			m_thread(0),
+			m_latches(0),
+			m_frames(0),
+			m_time(0.0),
+			m_offThread(0)
+		{
+		}
+
+		virtual void renderLatchCamera()
+		{
+			checkThread();
+			++m_latches;
+		}
+
+		virtual void renderSetTime(double time)
+		{
+			checkThread();
+			m_time = time;
+		}
+
+		virtual void renderResize(unsigned int width, unsigned int height)
+		{
+			checkThread();
+			m_widths.push_back(width);
+			m_heights.push_back(height);
+		}
+
+		virtual void renderFrame()
+		{
+			checkThread();
+			++m_frames;
+		}
+
+		const RenderThread*	m_thread;
+		int		m_latches;
+		int		m_frames;
+		double	m_time;
+		int		m_offThread;
+		std::vector<unsigned int>	m_widths;
+		std::vector<unsigned int>	m_heights;
+
+	protected:
+		void checkThread()
+		{
+			if(!m_thread || !m_thread->isCurrent()) ++m_offThread;
+		}
+	};
+}
+
+//! Commands beyond the queue size spill over and still arrive in order, before the quit
+void testRenderThreadQueue()
+{
+	const unsigned int RESIZES = RenderThread::QUEUE_SIZE * 4;
+
+	NullBackend backend;
+	RenderThread thread(&backend);
+	backend.m_thread = &thread;
+	CHECK(thread.start());
+
+	for(unsigned int n=1; n<=RESIZES; ++n)
+	{
+		thread.post(RenderCommand::resize(n, n * 2));
+		thread.post(RenderCommand::setTime((double)n));
+		thread.post(RenderCommand::camera());
+	}
+	thread.requestFrame();
+	thread.stop();
+
+	CHECK(!thread.hasOverflow());
+	CHECK(backend.m_offThread == 0);
+	CHECK(backend.m_widths.size() == RESIZES);
+
+	bool ordered = (backend.m_widths.size() == RESIZES);
+	for(size_t n=0; ordered && n<backend.m_widths.size(); ++n)
+	{
+		ordered = backend.m_widths[n] == n + 1 && backend.m_heights[n] == (n + 1) * 2;
+	}
+	CHECK(ordered);
+
+	// time and camera messages collapse, but the last ones always arrive
+	CHECK(backend.m_time == (double)RESIZES);
+	CHECK(backend.m_latches >= 1 && backend.m_latches <= (int)RESIZES);
+}
+
+//! Frame requests collapse while the renderer is busy, every frame renders on the render thread
+void testRenderThreadFrames()
+{
+	const int REQUESTS = 10000;
+
+	NullBackend backend;
+	RenderThread thread(&backend);
+	backend.m_thread = &thread;
+	CHECK(thread.start());
+
+	for(int n=0; n<REQUESTS; ++n)
+	{
+		thread.post(RenderCommand::camera());
+		thread.requestFrame();
+	}
+
+	// a request still pending when the quit arrives is dropped, so wait for one frame
+	while(thread.framesRendered() == 0)
+	{
+		Thread::yield();
+	}
+	thread.stop();
+
+	CHECK(backend.m_offThread == 0);
+	CHECK(backend.m_frames == thread.framesRendered());
+	CHECK(backend.m_frames >= 1 && backend.m_frames <= REQUESTS);
+	CHECK(backend.m_latches >= 1);
+}
@@ -0,0 +1,58 @@
+/*!
+	@brief ResizePolicy debouncing
+	@author Shintaro Takemura
+*/
+
+#include "tests.h"
+#include "../common/resizepolicy.h"
+#include "../common/thread.h"
+
+namespace
+{
+	void sleepSeconds(double seconds)
+	{
+		HighResolutionTimer timer;
+		while(timer.seconds() < seconds)
+		{
+			Thread::yield();
+		}
+	}
+}
+
+//! First resize applies at once, a storm is held back and settles on its last size
+void testResizePolicyDebounce()
+{
+	ResizePolicy policy;
+	policy.setDebounce(0.05);
+
+	CHECK(policy.request(800, 600) == ResizePolicy::ACTION_APPLY);
+	CHECK(policy.getWidth() == 800 && policy.getHeight() == 600);
+
+	CHECK(policy.request(810, 600) == ResizePolicy::ACTION_DEFER);
+	CHECK(policy.request(820, 610) == ResizePolicy::ACTION_DEFER);
+	CHECK(policy.isPending());
+	CHECK(policy.getSettleDelay() > 0);
+	CHECK(policy.settle() == ResizePolicy::ACTION_DEFER);
+	CHECK(policy.getWidth() == 800);
+
+	sleepSeconds(0.06);
+	CHECK(policy.getSettleDelay() == 0);
+	CHECK(policy.settle() == ResizePolicy::ACTION_APPLY);
+	CHECK(policy.getWidth() == 820 && policy.getHeight() == 610);
+	CHECK(policy.settle() == ResizePolicy::ACTION_NONE);
+
+	// back to the applied size within the storm cancels the pending one
+	sleepSeconds(0.06);
+	CHECK(policy.request(820, 610) == ResizePolicy::ACTION_NONE);
+	CHECK(policy.request(900, 700) == ResizePolicy::ACTION_DEFER);
+	CHECK(policy.request(820, 610) == ResizePolicy::ACTION_NONE);
+	CHECK(!policy.isPending());
+
+	// a device reset forgets the applied size
+	sleepSeconds(0.06);
+	policy.invalidate();
+	CHECK(policy.request(820, 610) == ResizePolicy::ACTION_APPLY);
+
+	CHECK(policy.getAppliedCount() == 3);
+	CHECK(policy.getDeferredCount() == 3);
+}
@@ -0,0 +1,54 @@
+/*!
+	@brief Minimal test harness shared by the QtDXTests sources
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+
+#include <cstdio>
+
+//! Record a failure and keep going; the test case fails at its end
+#define CHECK(expr)	((expr) ? (void)0 : checkFailed(#expr, __FILE__, __LINE__))
+
+void checkFailed(const char *expr, const char *file, int line);
+
+//! Heap allocations through the global operator new / new[] since the process started
+int allocationCount();
+
+// binarylogtest.cpp
+void testBinaryLogMacros();
+void testBinaryLogThreadBuffers();
+void testBinaryLogTimeOrder();
+void testBinaryLogDecode();
+
+// cameratracktest.cpp
+void testCameraTrackLoad();
+
+// camerasnapshottest.cpp
+void testSnapshotNotTorn();
+
+// framestatstest.cpp
+void testFrameStatsPresentInRender();
+
+// loggingtest.cpp
+void testLoggingNoAllocations();
+void testLoggingChanged();
+
+// logsinktest.cpp
+void testMappedLogSinkRotation();
+
+// logstamptest.cpp
+void testLogClockLazyCalibration();
+
+// profilertest.cpp
+void testProfileBufferCopy();
+
+// renderthreadtest.cpp
+void testRenderThreadQueue();
+void testRenderThreadFrames();
+
+// resizepolicytest.cpp
+void testResizePolicyDebounce();
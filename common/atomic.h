@@ -0,0 +1,121 @@
+/*!
+	@brief Minimal atomic operations (Interlocked / GCC builtins)
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+//! Compiler and CPU fence: earlier loads complete before later loads/stores
+inline void atomicAcquireFence()
+{
+#ifdef _MSC_VER
+	_ReadWriteBarrier();	// x86/x64 do not reorder loads with later loads or stores
+#else
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+#endif
+}
+
+//! Compiler and CPU fence: earlier loads/stores complete before later stores
+inline void atomicReleaseFence()
+{
+#ifdef _MSC_VER
+	_ReadWriteBarrier();	// x86/x64 do not reorder stores with earlier loads or stores
+#else
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+#endif
+}
+
+//! Full fence
+inline void atomicFullFence()
+{
+#ifdef _MSC_VER
+	MemoryBarrier();
+#else
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+//! 32-bit integer with acquire loads and release stores
+class AtomicInt
+{
+public:
+	explicit AtomicInt(int value = 0) : m_value(value) {}
+
+	int load() const
+	{
+#ifdef _MSC_VER
+		int value = m_value;	// volatile read has acquire semantics in MSVC
+		_ReadWriteBarrier();
+		return value;
+#else
+		return __atomic_load_n(&m_value, __ATOMIC_ACQUIRE);
+#endif
+	}
+
+	//! relaxed load, for the owner of the value
+	int loadRelaxed() const
+	{
+#ifdef _MSC_VER
+		return m_value;
+#else
+		return __atomic_load_n(&m_value, __ATOMIC_RELAXED);
+#endif
+	}
+
+	void store(int value)
+	{
+#ifdef _MSC_VER
+		_ReadWriteBarrier();
+		m_value = value;	// volatile write has release semantics in MSVC
+#else
+		__atomic_store_n(&m_value, value, __ATOMIC_RELEASE);
+#endif
+	}
+
+	//! returns the previous value
+	int fetchAdd(int value)
+	{
+#ifdef _MSC_VER
+		return (int)_InterlockedExchangeAdd(&m_value, value);
+#else
+		return __atomic_fetch_add(&m_value, value, __ATOMIC_ACQ_REL);
+#endif
+	}
+
+	//! returns the previous value
+	int exchange(int value)
+	{
+#ifdef _MSC_VER
+		return (int)_InterlockedExchange(&m_value, value);
+#else
+		return __atomic_exchange_n(&m_value, value, __ATOMIC_ACQ_REL);
+#endif
+	}
+
+	//! true if the value was 'expected' and is now 'desired'
+	bool compareExchange(int expected, int desired)
+	{
+#ifdef _MSC_VER
+		return _InterlockedCompareExchange(&m_value, desired, expected) == expected;
+#else
+		return __atomic_compare_exchange_n(&m_value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+	}
+
+protected:
+#ifdef _MSC_VER
+	volatile long	m_value;
+#else
+	int				m_value;
+#endif
+
+private:
+	AtomicInt(const AtomicInt&);
+	AtomicInt& operator=(const AtomicInt&);
+};
@@ -0,0 +1,936 @@
+/*!
+	@brief Deferred-formatting binary logger
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/logging.h"
+#include "../common/logsink.h"
+#include "../common/logstamp.h"
+#include "../common/thread.h"
+#include "../common/timer.h"
+
+#include <climits>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+//! BINLOG_INFO(binlog, "fmt", args...): binlog.log(INFO, "fmt", args...) that skips evaluating args when the level is filtered
+#define BINLOG_DEBUG(logger_, ...)	do { if(logging<char>::DEBUG >= LOGGING_MIN_LEVEL && (logger_).isEnabledFor(logging<char>::DEBUG)) (logger_).log(logging<char>::DEBUG, __VA_ARGS__); } while(0)
+#define BINLOG_INFO(logger_, ...)	do { if(logging<char>::INFO >= LOGGING_MIN_LEVEL && (logger_).isEnabledFor(logging<char>::INFO)) (logger_).log(logging<char>::INFO, __VA_ARGS__); } while(0)
+#define BINLOG_WARN(logger_, ...)	do { if(logging<char>::WARN >= LOGGING_MIN_LEVEL && (logger_).isEnabledFor(logging<char>::WARN)) (logger_).log(logging<char>::WARN, __VA_ARGS__); } while(0)
+#define BINLOG_ERROR(logger_, ...)	do { if(logging<char>::ERROR >= LOGGING_MIN_LEVEL && (logger_).isEnabledFor(logging<char>::ERROR)) (logger_).log(logging<char>::ERROR, __VA_ARGS__); } while(0)
+#define BINLOG_FATAL(logger_, ...)	do { if(logging<char>::FATAL >= LOGGING_MIN_LEVEL && (logger_).isEnabledFor(logging<char>::FATAL)) (logger_).log(logging<char>::FATAL, __VA_ARGS__); } while(0)
+
+//! Captured argument encodings
+enum BinaryLogTag
+{
+	BINLOG_TAG_INT = 1,		//!< long long
+	BINLOG_TAG_UINT,		//!< unsigned long long
+	BINLOG_TAG_DOUBLE,		//!< double
+	BINLOG_TAG_STRING,		//!< length byte followed by the characters
+	BINLOG_TAG_POINTER,		//!< const void*
+};
+
+/*!
+	How one argument type is stored. Types without a specialization do not
+	compile, so a record can always be decoded without the original call site.
+*/
+template<class T> struct BinaryLogArg;
+
+template<class T, class Stored, int Tag>
+struct BinaryLogScalar
+{
+	enum { TAG = Tag };
+
+	static size_t size(const T&)
+	{
+		return 1 + sizeof(Stored);
+	}
+
+	static char* store(char *p, const T &value)
+	{
+		Stored stored = (Stored)value;
+		*p++ = (char)Tag;
+		memcpy(p, &stored, sizeof(Stored));
+		return p + sizeof(Stored);
+	}
+};
+
+template<> struct BinaryLogArg<char> : BinaryLogScalar<char, long long, BINLOG_TAG_INT> {};
+template<> struct BinaryLogArg<signed char> : BinaryLogScalar<signed char, long long, BINLOG_TAG_INT> {};
+template<> struct BinaryLogArg<short> : BinaryLogScalar<short, long long, BINLOG_TAG_INT> {};
+template<> struct BinaryLogArg<int> : BinaryLogScalar<int, long long, BINLOG_TAG_INT> {};
+template<> struct BinaryLogArg<long> : BinaryLogScalar<long, long long, BINLOG_TAG_INT> {};
+template<> struct BinaryLogArg<long long> : BinaryLogScalar<long long, long long, BINLOG_TAG_INT> {};
+template<> struct BinaryLogArg<bool> : BinaryLogScalar<bool, unsigned long long, BINLOG_TAG_UINT> {};
+template<> struct BinaryLogArg<unsigned char> : BinaryLogScalar<unsigned char, unsigned long long, BINLOG_TAG_UINT> {};
+template<> struct BinaryLogArg<unsigned short> : BinaryLogScalar<unsigned short, unsigned long long, BINLOG_TAG_UINT> {};
+template<> struct BinaryLogArg<unsigned int> : BinaryLogScalar<unsigned int, unsigned long long, BINLOG_TAG_UINT> {};
+template<> struct BinaryLogArg<unsigned long> : BinaryLogScalar<unsigned long, unsigned long long, BINLOG_TAG_UINT> {};
+template<> struct BinaryLogArg<unsigned long long> : BinaryLogScalar<unsigned long long, unsigned long long, BINLOG_TAG_UINT> {};
+template<> struct BinaryLogArg<float> : BinaryLogScalar<float, double, BINLOG_TAG_DOUBLE> {};
+template<> struct BinaryLogArg<double> : BinaryLogScalar<double, double, BINLOG_TAG_DOUBLE> {};
+
+//! Strings are copied, at most MAX_LENGTH characters
+template<>
+struct BinaryLogArg<const char*>
+{
+	enum { TAG = BINLOG_TAG_STRING, MAX_LENGTH = 255 };
+
+	static size_t length(const char *value)
+	{
+		if(!value) return 0;
+		size_t n = 0;
+		while(n < MAX_LENGTH && value[n]) ++n;
+		return n;
+	}
+
+	static size_t size(const char *value)
+	{
+		return 2 + length(value);
+	}
+
+	static char* store(char *p, const char *value)
+	{
+		size_t n = length(value);
+		*p++ = (char)TAG;
+		*p++ = (char)(unsigned char)n;
+		memcpy(p, value, n);
+		return p + n;
+	}
+};
+
+template<> struct BinaryLogArg<char*> : BinaryLogArg<const char*> {};
+template<size_t N> struct BinaryLogArg<char[N]> : BinaryLogArg<const char*> {};
+template<size_t N> struct BinaryLogArg<const char[N]> : BinaryLogArg<const char*> {};
+
+template<>
+struct BinaryLogArg<std::string>
+{
+	static size_t size(const std::string &value)
+	{
+		return BinaryLogArg<const char*>::size(value.c_str());
+	}
+
+	static char* store(char *p, const std::string &value)
+	{
+		return BinaryLogArg<const char*>::store(p, value.c_str());
+	}
+};
+
+template<class T>
+struct BinaryLogArg<T*> : BinaryLogScalar<T*, const void*, BINLOG_TAG_POINTER> {};
+
+//! Fixed part of every record; the captured arguments follow it
+struct BinaryLogRecord
+{
+	enum { SKIP = 0xff };
+
+	unsigned int	size;		//!< whole record in bytes, a multiple of 8
+	unsigned char	level;
+	unsigned char	argCount;	//!< SKIP: padding up to the end of the ring
+	unsigned short	thread;		//!< LogStamp::threadId()
+	const char*		format;		//!< the call site's string literal, never copied
+	long long		timestamp;	//!< LogStamp::readTicks()
+};
+
+/*!
+	BinaryLog::OUTPUT_BINARY writes a sequence of chunks, each a BinaryLogChunk
+	followed by 'size' bytes, which BinaryLogDecoder turns into text later.
+*/
+struct BinaryLogChunk
+{
+	enum
+	{
+		HEADER = 1,		//!< BinaryLogHeader, always the first chunk
+		CALIBRATION,	//!< LogCalibration of the records that follow
+		FORMAT,			//!< unsigned long long id, the string's address in the logging process, then the characters
+		RECORD,			//!< BinaryLogRecord and its arguments as captured, 'format' holds the id
+	};
+
+	unsigned int	type;
+	unsigned int	size;
+};
+
+struct BinaryLogHeader
+{
+	enum { VERSION = 1 };
+
+	char			magic[8];		//!< "QTDXBLOG"
+	unsigned int	version;
+	unsigned int	pointerSize;	//!< sizeof(void*) of the logging process
+};
+
+/*!
+	Byte ring written by one thread and drained by the logger's writer thread.
+	Records never wrap; the gap at the end of the ring is filled with a SKIP record.
+*/
+class BinaryLogBuffer
+{
+public:
+	enum
+	{
+		CAPACITY = 64 * 1024,
+	};
+
+	BinaryLogBuffer() : m_head(0), m_tail(0), m_full(false)
+	{
+	}
+
+	//! Producer: room for 'size' bytes (a multiple of 8), 0 when full
+	char* reserve(unsigned int size)
+	{
+		unsigned int tail = (unsigned int)m_tail.loadRelaxed();
+		unsigned int head = (unsigned int)m_head.load();
+		unsigned int offset = tail & (CAPACITY - 1);
+		unsigned int gap = CAPACITY - offset;
+
+		if(size > gap)
+		{
+			// pad to the end of the ring and start over at its beginning
+			if(tail + gap + size - head > CAPACITY)
+			{
+				m_full = true;
+				return 0;
+			}
+
+			BinaryLogRecord *skip = (BinaryLogRecord*)(m_data + offset);
+			skip->size = gap;
+			skip->argCount = BinaryLogRecord::SKIP;
+			tail += gap;
+			m_tail.store((int)tail);
+			offset = 0;
+		}
+		else if(tail + size - head > CAPACITY)
+		{
+			m_full = true;
+			return 0;
+		}
+		m_full = false;
+		return m_data + offset;
+	}
+
+	//! Producer: the last reserve() failed
+	bool isFull() const
+	{
+		return m_full;
+	}
+
+	//! Producer: publish the record written at reserve()
+	void commit(unsigned int size)
+	{
+		m_tail.store((int)((unsigned int)m_tail.loadRelaxed() + size));
+	}
+
+	//! Consumer: next record, 0 when empty
+	const BinaryLogRecord* front()
+	{
+		for(;;)
+		{
+			unsigned int head = (unsigned int)m_head.loadRelaxed();
+			if(head == (unsigned int)m_tail.load()) return 0;
+
+			const BinaryLogRecord *record = (const BinaryLogRecord*)(m_data + (head & (CAPACITY - 1)));
+			if(record->argCount != BinaryLogRecord::SKIP) return record;
+			pop(record);
+		}
+	}
+
+	//! Consumer: release the record returned by front()
+	void pop(const BinaryLogRecord *record)
+	{
+		m_head.store((int)((unsigned int)m_head.loadRelaxed() + record->size));
+	}
+
+protected:
+	//! records are read in place, keep them aligned
+	union
+	{
+		char		m_data[CAPACITY];
+		long long	m_align;
+	};
+
+	AtomicInt	m_head;
+	char		m_padding[64];
+	AtomicInt	m_tail;
+	bool		m_full;
+};
+
+/*!
+	Logs a static format string, a timestamp, the thread and the raw arguments
+	into a per-thread buffer; a background thread formats the records, each
+	prefixed with "hh:mm:ss.uuuuuu [thread] ", and writes them to a LogSink in
+	timestamp order. OUTPUT_BINARY writes the raw records instead and leaves
+	the formatting to QtDXLogDecode. Format strings have to outlive the
+	logger, i.e. be literals. Supports %d %i %u %x %X %o %c %f %e %g %a %s %p
+	with the usual flags, width and precision; length modifiers are taken
+	from the argument.
+*/
+class BinaryLog : protected Thread
+{
+public:
+	enum Output
+	{
+		OUTPUT_TEXT = 0,	//!< formatted lines
+		OUTPUT_BINARY,		//!< BinaryLogChunk stream for BinaryLogDecoder, nothing is formatted
+	};
+
+	enum
+	{
+		MAX_RECORD = 1024,
+		//! Loggers alive at the same time; further ones drop everything they are given
+		MAX_LOGGERS = 64,
+	};
+
+	explicit BinaryLog(LogSink *sink, unsigned int intervalMs = 50, Output output = OUTPUT_TEXT) :
+		m_sink(sink),
+		m_interval(std::max(intervalMs, 1u)),
+		m_output(output),
+		m_level(logging<char>::INFO),
+		m_lock(0),
+		m_quit(0),
+		m_flushRequested(0),
+		m_flushed(0),
+		m_dropped(0)
+	{
+		static AtomicInt s_serial;
+		m_serial = s_serial.fetchAdd(1) + 1;
+
+		m_slot = -1;
+		for(int i=0; i<MAX_LOGGERS && m_slot < 0; ++i)
+		{
+			if(slots()[i].compareExchange(0, 1)) m_slot = i;
+		}
+#ifdef _DEBUG
+		m_level = logging<char>::DEBUG;
+#endif
+		start();
+	}
+
+	virtual ~BinaryLog()
+	{
+		m_quit.store(1);
+		m_wake.signal();
+		join();
+
+		for(size_t n=0; n<m_buffers.size(); ++n)
+		{
+			delete m_buffers[n];
+		}
+		if(m_slot >= 0) slots()[m_slot].store(0);
+	}
+
+	void setLevel(int level)
+	{
+		m_level = level;
+	}
+
+	bool isEnabledFor(int level) const
+	{
+		return level >= LOGGING_MIN_LEVEL && level >= m_level;
+	}
+
+	void log(int level, const char *format)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 0, 0, buffer);
+		if(record) buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	template<class A1>
+	void log(int level, const char *format, const A1 &a1)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 1, BinaryLogArg<A1>::size(a1), buffer);
+		if(!record) return;
+		char *p = record + sizeof(BinaryLogRecord);
+		p = BinaryLogArg<A1>::store(p, a1);
+		buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	template<class A1, class A2>
+	void log(int level, const char *format, const A1 &a1, const A2 &a2)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 2, BinaryLogArg<A1>::size(a1) + BinaryLogArg<A2>::size(a2), buffer);
+		if(!record) return;
+		char *p = record + sizeof(BinaryLogRecord);
+		p = BinaryLogArg<A1>::store(p, a1);
+		p = BinaryLogArg<A2>::store(p, a2);
+		buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	template<class A1, class A2, class A3>
+	void log(int level, const char *format, const A1 &a1, const A2 &a2, const A3 &a3)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 3, BinaryLogArg<A1>::size(a1) + BinaryLogArg<A2>::size(a2) + BinaryLogArg<A3>::size(a3), buffer);
+		if(!record) return;
+		char *p = record + sizeof(BinaryLogRecord);
+		p = BinaryLogArg<A1>::store(p, a1);
+		p = BinaryLogArg<A2>::store(p, a2);
+		p = BinaryLogArg<A3>::store(p, a3);
+		buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	template<class A1, class A2, class A3, class A4>
+	void log(int level, const char *format, const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 4, BinaryLogArg<A1>::size(a1) + BinaryLogArg<A2>::size(a2) + BinaryLogArg<A3>::size(a3)
+			+ BinaryLogArg<A4>::size(a4), buffer);
+		if(!record) return;
+		char *p = record + sizeof(BinaryLogRecord);
+		p = BinaryLogArg<A1>::store(p, a1);
+		p = BinaryLogArg<A2>::store(p, a2);
+		p = BinaryLogArg<A3>::store(p, a3);
+		p = BinaryLogArg<A4>::store(p, a4);
+		buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	template<class A1, class A2, class A3, class A4, class A5>
+	void log(int level, const char *format, const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4, const A5 &a5)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 5, BinaryLogArg<A1>::size(a1) + BinaryLogArg<A2>::size(a2) + BinaryLogArg<A3>::size(a3)
+			+ BinaryLogArg<A4>::size(a4) + BinaryLogArg<A5>::size(a5), buffer);
+		if(!record) return;
+		char *p = record + sizeof(BinaryLogRecord);
+		p = BinaryLogArg<A1>::store(p, a1);
+		p = BinaryLogArg<A2>::store(p, a2);
+		p = BinaryLogArg<A3>::store(p, a3);
+		p = BinaryLogArg<A4>::store(p, a4);
+		p = BinaryLogArg<A5>::store(p, a5);
+		buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	template<class A1, class A2, class A3, class A4, class A5, class A6>
+	void log(int level, const char *format, const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4, const A5 &a5, const A6 &a6)
+	{
+		BinaryLogBuffer *buffer;
+		char *record = begin(level, format, 6, BinaryLogArg<A1>::size(a1) + BinaryLogArg<A2>::size(a2) + BinaryLogArg<A3>::size(a3)
+			+ BinaryLogArg<A4>::size(a4) + BinaryLogArg<A5>::size(a5) + BinaryLogArg<A6>::size(a6), buffer);
+		if(!record) return;
+		char *p = record + sizeof(BinaryLogRecord);
+		p = BinaryLogArg<A1>::store(p, a1);
+		p = BinaryLogArg<A2>::store(p, a2);
+		p = BinaryLogArg<A3>::store(p, a3);
+		p = BinaryLogArg<A4>::store(p, a4);
+		p = BinaryLogArg<A5>::store(p, a5);
+		p = BinaryLogArg<A6>::store(p, a6);
+		buffer->commit(((BinaryLogRecord*)record)->size);
+	}
+
+	//! Any thread: returns once everything logged before the call has reached the sink
+	void flush()
+	{
+		int requested = m_flushRequested.fetchAdd(1) + 1;
+		while(m_flushed.load() - requested < 0)
+		{
+			m_wake.signal();
+			Thread::yield();
+		}
+	}
+
+	//! Records lost to a full per-thread buffer, over MAX_RECORD or to a logger without a slot
+	int dropped() const
+	{
+		return m_dropped.load();
+	}
+
+	//! Per-thread buffers attached so far, one for every thread that logged
+	size_t threadCount()
+	{
+		lock();
+		size_t count = m_buffers.size();
+		unlock();
+		return count;
+	}
+
+	//! Append the text of one record, without a line break
+	static void format(const BinaryLogRecord *record, std::string &out)
+	{
+		format(record, record->format, out);
+	}
+
+	//! Same with the format string given, for records read back from a binary log
+	static void format(const BinaryLogRecord *record, const char *formatText, std::string &out)
+	{
+		const char *args = (const char*)(record + 1);
+		const char *end = (const char*)record + record->size;
+		int remaining = record->argCount;
+
+		for(const char *f = formatText; *f; ++f)
+		{
+			if(*f != '%')
+			{
+				out += *f;
+				continue;
+			}
+			if(f[1] == '%')
+			{
+				out += '%';
+				++f;
+				continue;
+			}
+
+			// %[flags][width][.precision][length]conversion, rebuilt with the length of the stored type
+			const char *start = f++;
+			while(*f && strchr("-+ #0", *f)) ++f;
+			while(*f >= '0' && *f <= '9') ++f;
+			if(*f == '.')
+			{
+				++f;
+				while(*f >= '0' && *f <= '9') ++f;
+			}
+			std::string spec(start, f);
+			while(*f && strchr("hlLqjztI0123456789", *f)) ++f;
+			if(!*f) break;
+
+			// without an argument left, or from one that does not fit the record, the conversion stays as it is
+			if(remaining > 0 && args)
+			{
+				--remaining;
+				args = formatArg(args, end, spec, *f, out);
+				if(args) continue;
+			}
+			out.append(start, f + 1);
+		}
+	}
+
+protected:
+	//! Claimed by the live loggers, each thread keeps its buffer for the logger in the same slot
+	static AtomicInt* slots()
+	{
+		static AtomicInt s_slots[MAX_LOGGERS];
+		return s_slots;
+	}
+
+	//! The calling thread's buffer for this logger, attached on first use
+	BinaryLogBuffer* threadBuffer()
+	{
+		struct Entry
+		{
+			int					serial;
+			BinaryLogBuffer*	buffer;
+		};
+		static LOGGING_THREAD_LOCAL Entry t_slots[MAX_LOGGERS];
+
+		// a different serial is a logger that had the slot before, its buffers went with it
+		Entry &entry = t_slots[m_slot];
+		if(entry.serial == m_serial) return entry.buffer;
+
+		BinaryLogBuffer *buffer = new BinaryLogBuffer;
+		lock();
+		m_buffers.push_back(buffer);
+		unlock();
+
+		entry.serial = m_serial;
+		entry.buffer = buffer;
+		return buffer;
+	}
+
+	//! Reserve and fill in the header of a record; commit it once the arguments are stored
+	char* begin(int level, const char *format, int argCount, size_t argBytes, BinaryLogBuffer *&buffer)
+	{
+		if(!isEnabledFor(level)) return 0;
+
+		size_t size = (sizeof(BinaryLogRecord) + argBytes + 7) & ~(size_t)7;
+		if(size > MAX_RECORD || m_slot < 0)
+		{
+			m_dropped.fetchAdd(1);
+			return 0;
+		}
+
+		buffer = threadBuffer();
+		bool wasFull = buffer->isFull();
+		char *p = buffer->reserve((unsigned int)size);
+		if(!p)
+		{
+			// wake the writer as the buffer fills up, not again for every call dropped after that
+			m_dropped.fetchAdd(1);
+			if(!wasFull) m_wake.signal();
+			return 0;
+		}
+
+		BinaryLogRecord *record = (BinaryLogRecord*)p;
+		record->size = (unsigned int)size;
+		record->level = (unsigned char)level;
+		record->argCount = (unsigned char)argCount;
+		record->format = format;
+		record->thread = (unsigned short)LogStamp::threadId();
+		record->timestamp = LogStamp::readTicks();
+		return p;
+	}
+
+	void lock()
+	{
+		while(!m_lock.compareExchange(0, 1))
+		{
+			Thread::yield();
+		}
+	}
+
+	void unlock()
+	{
+		m_lock.store(0);
+	}
+
+	virtual void run()
+	{
+		std::string text;
+		std::vector<BinaryLogBuffer*> buffers;
+
+		if(m_output == OUTPUT_BINARY)
+		{
+			BinaryLogHeader header;
+			memcpy(header.magic, "QTDXBLOG", sizeof(header.magic));
+			header.version = BinaryLogHeader::VERSION;
+			header.pointerSize = sizeof(void*);
+			appendChunk(text, BinaryLogChunk::HEADER, &header, sizeof(header));
+		}
+
+		for(;;)
+		{
+			bool quit = m_quit.load() != 0;
+			int flushRequested = m_flushRequested.load();
+
+			lock();
+			buffers = m_buffers;
+			unlock();
+
+			m_clock.calibrate();
+
+			// records younger than a millisecond wait for the next pass, a thread that took
+			// an earlier timestamp may not have committed yet; flush and quit take everything
+			long long cutoff = LogStamp::readTicks() - (long long)(m_clock.getFrequency() / 1000.0);
+			if(quit || m_flushed.load() != flushRequested) cutoff = LLONG_MAX;
+
+			// merge the threads' records by timestamp
+			bool calibrationWritten = false;
+			for(;;)
+			{
+				BinaryLogBuffer *oldest = 0;
+				const BinaryLogRecord *record = 0;
+				for(size_t n=0; n<buffers.size(); ++n)
+				{
+					const BinaryLogRecord *front = buffers[n]->front();
+					if(front && front->timestamp <= cutoff && (!record || front->timestamp < record->timestamp))
+					{
+						oldest = buffers[n];
+						record = front;
+					}
+				}
+				if(!record) break;
+
+				if(m_output == OUTPUT_BINARY)
+				{
+					if(!calibrationWritten)
+					{
+						LogCalibration calibration = m_clock.getCalibration();
+						appendChunk(text, BinaryLogChunk::CALIBRATION, &calibration, sizeof(calibration));
+						calibrationWritten = true;
+					}
+					if(m_formats.insert(record->format).second)
+					{
+						unsigned long long id = (unsigned long long)(size_t)record->format;
+						size_t length = strlen(record->format);
+						BinaryLogChunk chunk = { BinaryLogChunk::FORMAT, (unsigned int)(sizeof(id) + length) };
+						text.append((const char*)&chunk, sizeof(chunk));
+						text.append((const char*)&id, sizeof(id));
+						text.append(record->format, length);
+					}
+					appendChunk(text, BinaryLogChunk::RECORD, record, record->size);
+				}
+				else
+				{
+					char prefix[LogClock::TEXT_SIZE];
+					text.append(prefix, m_clock.format(record->timestamp, record->thread, prefix));
+					format(record, text);
+					text += '\n';
+				}
+				oldest->pop(record);
+
+				if(text.size() >= 64 * 1024)
+				{
+					m_sink->write(0, text.data(), text.size());
+					text.clear();
+				}
+			}
+			if(!text.empty())
+			{
+				m_sink->write(0, text.data(), text.size());
+				text.clear();
+			}
+			if(m_flushed.load() != flushRequested)
+			{
+				m_sink->flush();
+				m_flushed.store(flushRequested);
+			}
+
+			if(quit) break;
+			m_wake.wait(m_interval);
+		}
+		m_sink->flush();
+	}
+
+	static void appendChunk(std::string &out, unsigned int type, const void *data, size_t size)
+	{
+		BinaryLogChunk chunk = { type, (unsigned int)size };
+		out.append((const char*)&chunk, sizeof(chunk));
+		out.append((const char*)data, size);
+	}
+
+	//! Format the argument at 'args' and return the next one, 0 if it would cross 'end'
+	static const char* formatArg(const char *args, const char *end, std::string spec, char conversion, std::string &out)
+	{
+		if(end - args < 2) return 0;
+
+		char tag = *args++;
+		char buffer[320];
+		buffer[0] = 0;
+
+		bool integer = strchr("diuxXoc", conversion) != 0;
+		bool floating = strchr("fFeEgGaA", conversion) != 0;
+
+		switch(tag)
+		{
+		case BINLOG_TAG_INT:
+		case BINLOG_TAG_UINT:
+		case BINLOG_TAG_DOUBLE:
+			{
+				long long i;
+				unsigned long long u;
+				double d;
+				if(end - args < 8) return 0;
+				memcpy(&i, args, 8);
+				memcpy(&u, args, 8);
+				memcpy(&d, args, 8);
+				args += 8;
+
+				if(tag == BINLOG_TAG_DOUBLE && !floating)
+				{
+					i = (long long)d;
+					u = (unsigned long long)d;
+					tag = BINLOG_TAG_INT;
+				}
+
+				if(tag == BINLOG_TAG_DOUBLE || floating)
+				{
+					if(tag != BINLOG_TAG_DOUBLE) d = (tag == BINLOG_TAG_INT) ? (double)i : (double)u;
+					spec += floating ? conversion : 'g';
+					formatValue(buffer, sizeof(buffer), spec.c_str(), d);
+				}
+				else if(conversion == 'c')
+				{
+					spec += 'c';
+					formatValue(buffer, sizeof(buffer), spec.c_str(), (int)i);
+				}
+				else if(conversion == 'd' || conversion == 'i' || (!integer && tag == BINLOG_TAG_INT))
+				{
+					spec += "lld";
+					formatValue(buffer, sizeof(buffer), spec.c_str(), i);
+				}
+				else
+				{
+					spec += "ll";
+					spec += integer ? conversion : 'u';
+					formatValue(buffer, sizeof(buffer), spec.c_str(), u);
+				}
+			}
+			break;
+
+		case BINLOG_TAG_STRING:
+			{
+				size_t length = (unsigned char)*args++;
+				if((size_t)(end - args) < length) return 0;
+				std::string value(args, length);
+				args += length;
+
+				spec += 's';
+				formatValue(buffer, sizeof(buffer), spec.c_str(), value.c_str());
+			}
+			break;
+
+		case BINLOG_TAG_POINTER:
+			{
+				const void *value;
+				if(end - args < (ptrdiff_t)sizeof(value)) return 0;
+				memcpy(&value, args, sizeof(value));
+				args += sizeof(value);
+
+				spec += 'p';
+				formatValue(buffer, sizeof(buffer), spec.c_str(), value);
+			}
+			break;
+
+		default:
+			return 0;
+		}
+
+		out += buffer;
+		return args;
+	}
+
+	static void formatValue(char *buffer, size_t size, const char *spec, ...)
+	{
+		va_list ap;
+		va_start(ap, spec);
+#ifdef _MSC_VER
+		_vsnprintf_s(buffer, size, _TRUNCATE, spec, ap);
+#else
+		vsnprintf(buffer, size, spec, ap);
+#endif
+		va_end(ap);
+	}
+
+	LogSink*		m_sink;
+	unsigned int	m_interval;
+	Output			m_output;
+	int				m_level;
+	int				m_serial;
+	//! index into slots() and every thread's buffer table, -1 when all MAX_LOGGERS were taken
+	int				m_slot;
+
+	//! every buffer ever attached, guarded by m_lock
+	std::vector<BinaryLogBuffer*>	m_buffers;
+	AtomicInt		m_lock;
+
+	//! writer only
+	LogClock	m_clock;
+	//! format strings already written to a binary log, writer only
+	std::set<const char*>	m_formats;
+
+	Event		m_wake;
+	AtomicInt	m_quit;
+	AtomicInt	m_flushRequested;
+	AtomicInt	m_flushed;
+	AtomicInt	m_dropped;
+
+	BinaryLog(const BinaryLog&);
+	BinaryLog& operator=(const BinaryLog&);
+};
+
+/*!
+	Turns BinaryLog::OUTPUT_BINARY back into the lines OUTPUT_TEXT would have
+	written. The log has to come from a build with the same pointer size and
+	byte order; it can be fed in pieces of any size.
+*/
+class BinaryLogDecoder
+{
+public:
+	BinaryLogDecoder() : m_started(false), m_failed(false)
+	{
+	}
+
+	//! Append the lines of every complete chunk so far; false once the data is not a binary log
+	bool decode(const char *data, size_t size, std::string &out)
+	{
+		if(m_failed) return false;
+		m_pending.append(data, size);
+
+		size_t offset = 0;
+		while(m_pending.size() - offset >= sizeof(BinaryLogChunk))
+		{
+			BinaryLogChunk chunk;
+			memcpy(&chunk, m_pending.data() + offset, sizeof(chunk));
+			if(!m_started && (chunk.type != BinaryLogChunk::HEADER || chunk.size != sizeof(BinaryLogHeader)))
+			{
+				m_failed = true;
+				return false;
+			}
+			if(m_pending.size() - offset - sizeof(chunk) < chunk.size) break;
+
+			if(!decodeChunk(chunk, m_pending.data() + offset + sizeof(chunk), out))
+			{
+				m_failed = true;
+				return false;
+			}
+			offset += sizeof(chunk) + chunk.size;
+		}
+		m_pending.erase(0, offset);
+		return true;
+	}
+
+	//! True if everything fed so far ended on a chunk boundary
+	bool complete() const
+	{
+		return m_pending.empty();
+	}
+
+protected:
+	bool decodeChunk(const BinaryLogChunk &chunk, const char *payload, std::string &out)
+	{
+		if(!m_started)
+		{
+			BinaryLogHeader header;
+			memcpy(&header, payload, sizeof(header));
+			if(memcmp(header.magic, "QTDXBLOG", sizeof(header.magic)) != 0) return false;
+			if(header.version != BinaryLogHeader::VERSION || header.pointerSize != sizeof(void*)) return false;
+			m_started = true;
+			return true;
+		}
+
+		switch(chunk.type)
+		{
+		case BinaryLogChunk::CALIBRATION:
+			{
+				LogCalibration calibration;
+				if(chunk.size != sizeof(calibration)) return false;
+				memcpy(&calibration, payload, sizeof(calibration));
+				m_clock.setCalibration(calibration);
+			}
+			break;
+
+		case BinaryLogChunk::FORMAT:
+			{
+				unsigned long long id;
+				if(chunk.size < sizeof(id)) return false;
+				memcpy(&id, payload, sizeof(id));
+				m_formats[id].assign(payload + sizeof(id), chunk.size - sizeof(id));
+			}
+			break;
+
+		case BinaryLogChunk::RECORD:
+			{
+				if(chunk.size < sizeof(BinaryLogRecord) || chunk.size > BinaryLog::MAX_RECORD) return false;
+
+				// arguments are read in place, copy the record to aligned memory
+				m_record.resize((chunk.size + 7) / 8);
+				memcpy(&m_record[0], payload, chunk.size);
+				const BinaryLogRecord *record = (const BinaryLogRecord*)&m_record[0];
+				if(record->size != chunk.size) return false;
+
+				std::map<unsigned long long, std::string>::const_iterator formatText = m_formats.find((unsigned long long)(size_t)record->format);
+				if(formatText == m_formats.end()) return false;
+
+				char prefix[LogClock::TEXT_SIZE];
+				out.append(prefix, m_clock.format(record->timestamp, record->thread, prefix));
+				BinaryLog::format(record, formatText->second.c_str(), out);
+				out += '\n';
+			}
+			break;
+
+		default:
+			// unknown chunk types are skipped
+			break;
+		}
+		return true;
+	}
+
+	bool		m_started;
+	bool		m_failed;
+	std::string	m_pending;
+
+	LogClock	m_clock;
+	std::map<unsigned long long, std::string>	m_formats;
+	std::vector<long long>	m_record;
+};
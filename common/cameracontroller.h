@@ -0,0 +1,333 @@
+/*!
+	@brief Frame-rate independent camera controller
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+
+//! Collects tumble/dolly/track and wheel input between frames and applies it once per frame
+class CameraController
+{
+public:
+	enum Operation
+	{
+		NONE = 0,
+		TUMBLE,
+		DOLLY,
+		TRACK,
+	};
+
+	//! Bits returned by update()
+	enum Changed
+	{
+		CHANGED_NONE = 0,
+		CHANGED_TARGET = 1 << 0,
+		CHANGED_ORIENTATION = 1 << 1,
+		CHANGED_DISTANCE = 1 << 2,
+	};
+
+	CameraController() :
+		m_operation(NONE),
+		m_dragX(0.0f), m_dragY(0.0f),
+		m_pending(false),
+		m_wheelZoom(1.0f),
+		m_wheelPending(false),
+		m_rawEvents(0),
+		m_appliedUpdates(0),
+		m_smoothing(false),
+		m_smoothTime(0.08f),
+		m_settling(false),
+		m_dragDistance(1.0f)
+	{
+	}
+
+	//! Critically damped smoothing on target, orientation and distance
+	void setSmoothing(bool enabled, float smoothTime = 0.08f)
+	{
+		m_smoothing = enabled;
+		m_smoothTime = std::max(smoothTime, 0.001f);
+		m_settling = false;
+	}
+
+	bool isSmoothing() const
+	{
+		return m_smoothing;
+	}
+
+	//! Start a drag, the camera state is saved as the drag origin
+	void begin(Operation op, Camera &camera)
+	{
+		camera.backup();
+		m_operation = op;
+		m_dragX = m_dragY = 0.0f;
+		m_dragDistance = camera.getCenterOfInterest();
+		m_pending = false;
+		syncSmoothed(camera);
+	}
+
+	//! Total drag since begin(), in viewport heights. Only the latest value is kept
+	void drag(float dx, float dy)
+	{
+		if(m_operation == NONE) return;
+		++m_rawEvents;
+
+		if(dx != m_dragX || dy != m_dragY)
+		{
+			m_dragX = dx;
+			m_dragY = dy;
+			m_pending = true;
+		}
+	}
+
+	void end()
+	{
+		m_operation = NONE;
+	}
+
+	//! Scale the distance to the target; wheel steps within a frame multiply into one zoom
+	void zoom(float factor)
+	{
+		++m_rawEvents;
+		if(factor <= 0.0f || factor == 1.0f) return;
+
+		m_wheelZoom *= factor;
+		m_wheelPending = true;
+	}
+
+	//! Input events received, drags and wheel steps
+	unsigned int rawEventCount() const
+	{
+		return m_rawEvents;
+	}
+
+	//! update() calls that changed the camera from new input
+	unsigned int appliedUpdateCount() const
+	{
+		return m_appliedUpdates;
+	}
+
+	void resetCounters()
+	{
+		m_rawEvents = 0;
+		m_appliedUpdates = 0;
+	}
+
+	Operation operation() const
+	{
+		return m_operation;
+	}
+
+	//! true while update() still has work to do
+	bool isActive() const
+	{
+		return m_pending || m_wheelPending || m_settling;
+	}
+
+	//! Rebuild the camera once from the accumulated input; returns Changed bits
+	int update(Camera &camera, float dt)
+	{
+		int changed = CHANGED_NONE;
+
+		bool zoomed = m_wheelPending;
+		float zoom = m_wheelZoom;
+		m_wheelPending = false;
+		m_wheelZoom = 1.0f;
+
+		if(m_pending || zoomed)
+		{
+			++m_appliedUpdates;
+		}
+
+		if(m_pending)
+		{
+			m_pending = false;
+			camera.recover();
+
+			if(m_smoothing)
+			{
+				// recover() keeps the displayed distance, build from the requested one
+				camera.m_centerOfInterest = m_goal[STATE_DISTANCE];
+			}
+
+			switch(m_operation)
+			{
+			case TUMBLE:
+				camera.rotate(m_dragX * 180.0f, m_dragY * 180.0f, 0.0f);
+				changed |= CHANGED_ORIENTATION;
+				break;
+			case DOLLY:
+				camera.move(0.0f, 0.0f, m_dragY * m_dragDistance);
+				changed |= CHANGED_TARGET;
+				break;
+			case TRACK:
+				camera.move(-m_dragX * m_dragDistance, m_dragY * m_dragDistance, 0.0f);
+				changed |= CHANGED_TARGET;
+				break;
+			default:
+				break;
+			}
+
+			if(zoomed)
+			{
+				camera.zoom(zoom);
+				changed |= CHANGED_DISTANCE;
+				zoomed = false;
+			}
+
+			if(m_smoothing)
+			{
+				setGoal(camera);
+				m_settling = true;
+			}
+		}
+
+		if(zoomed)
+		{
+			if(m_smoothing)
+			{
+				if(!m_settling)
+				{
+					syncSmoothed(camera);
+				}
+				m_goal[STATE_DISTANCE] *= zoom;
+				m_settling = true;
+			}
+			else
+			{
+				camera.zoom(zoom);
+				changed |= CHANGED_DISTANCE;
+			}
+		}
+
+		if(!m_smoothing)
+		{
+			return changed;
+		}
+
+		if(m_settling)
+		{
+			changed |= smooth(camera, dt);
+		}
+		return changed;
+	}
+
+	//! Critically damped spring step (closed form, stable for any dt)
+	static float springDamp(float current, float goal, float &velocity, float smoothTime, float dt)
+	{
+		float omega = 2.0f / smoothTime;
+		float x = omega * dt;
+		float decay = 1.0f / (1.0f + x + 0.48f * x * x + 0.235f * x * x * x);
+		float change = current - goal;
+		float temp = (velocity + omega * change) * dt;
+		velocity = (velocity - omega * temp) * decay;
+		return goal + (change + temp) * decay;
+	}
+
+protected:
+	enum
+	{
+		STATE_TARGET = 0,
+		STATE_ORIENTATION = 3,
+		STATE_DISTANCE = 7,
+		STATE_SIZE = 8,
+	};
+
+	static void storeState(float *state, const Camera &camera)
+	{
+		for(int i=0; i<3; ++i) state[STATE_TARGET+i] = camera.m_target[i];
+		for(int i=0; i<4; ++i) state[STATE_ORIENTATION+i] = camera.m_orientation[i];
+		state[STATE_DISTANCE] = camera.m_centerOfInterest;
+	}
+
+	static void loadState(Camera &camera, const float *state)
+	{
+		const float *o = state + STATE_ORIENTATION;
+		camera.m_target = vmVector3(state[STATE_TARGET], state[STATE_TARGET+1], state[STATE_TARGET+2]);
+		camera.m_orientation = vmQuat(o[0], o[1], o[2], o[3]);
+		camera.m_centerOfInterest = state[STATE_DISTANCE];
+		camera.updateViewMatrix();
+	}
+
+	//! Move the displayed state toward the goal
+	int smooth(Camera &camera, float dt)
+	{
+		bool settled = true;
+		for(int i=0; i<STATE_SIZE; ++i)
+		{
+			m_state[i] = springDamp(m_state[i], m_goal[i], m_velocity[i], m_smoothTime, dt);
+			if(fabs(m_state[i] - m_goal[i]) > 1.0e-4f * std::max(1.0f, (float)fabs(m_goal[i])) || fabs(m_velocity[i]) > 1.0e-3f)
+			{
+				settled = false;
+			}
+		}
+
+		if(settled)
+		{
+			m_settling = false;
+			syncSmoothed(m_goal);
+		}
+
+		loadState(camera, m_state);
+		return CHANGED_TARGET | CHANGED_ORIENTATION | CHANGED_DISTANCE;
+	}
+
+	//! Record the freshly built camera as the new goal
+	void setGoal(const Camera &camera)
+	{
+		storeState(m_goal, camera);
+
+		// keep the goal quaternion in the hemisphere of the displayed one
+		float d = 0.0f;
+		for(int i=0; i<4; ++i) d += m_goal[STATE_ORIENTATION+i] * m_state[STATE_ORIENTATION+i];
+		if(d < 0.0f)
+		{
+			for(int i=0; i<4; ++i) m_goal[STATE_ORIENTATION+i] = -m_goal[STATE_ORIENTATION+i];
+		}
+	}
+
+	void syncSmoothed(const float *state)
+	{
+		for(int i=0; i<STATE_SIZE; ++i)
+		{
+			m_state[i] = m_goal[i] = state[i];
+			m_velocity[i] = 0.0f;
+		}
+	}
+
+	void syncSmoothed(const Camera &camera)
+	{
+		float state[STATE_SIZE];
+		storeState(state, camera);
+		syncSmoothed(state);
+	}
+
+	//! current drag
+	Operation	m_operation;
+	float	m_dragX;
+	float	m_dragY;
+	bool	m_pending;
+
+	//! wheel zoom gathered since the last update()
+	float	m_wheelZoom;
+	bool	m_wheelPending;
+
+	//! raw input events and the updates they were merged into
+	unsigned int	m_rawEvents;
+	unsigned int	m_appliedUpdates;
+
+	//! smoothing parameters
+	bool	m_smoothing;
+	float	m_smoothTime;
+	bool	m_settling;
+
+	//! distance used to scale dolly/track at drag start
+	float	m_dragDistance;
+
+	//! target(3), orientation(4) and distance(1) as displayed, requested and their velocity
+	float	m_state[STATE_SIZE];
+	float	m_goal[STATE_SIZE];
+	float	m_velocity[STATE_SIZE];
+};
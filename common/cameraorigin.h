@@ -0,0 +1,142 @@
+/*!
+	@brief Camera-relative (floating origin) transform pipeline
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+
+//! Keeps the world origin in double precision so the camera and all rendering stay in float32 near zero
+ATTRIBUTE_ALIGNED16_CLASS(class CameraRelativeFrame)
+{
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	CameraRelativeFrame() : m_rebaseDistance(1024.0f)
+	{
+		for(int i=0; i<3; ++i)
+		{
+			m_origin[i] = 0.0;
+			m_eyeWorld[i] = 0.0;
+		}
+		m_viewMatrix = vmMatrix4::identity();
+	}
+
+	//! Camera-local distance from the origin that triggers a rebase
+	void setRebaseDistance(float distance)
+	{
+		m_rebaseDistance = distance;
+	}
+
+	const double* getOrigin() const
+	{
+		return m_origin;
+	}
+
+	//! Camera eye in world space
+	const double* getEyeWorld() const
+	{
+		return m_eyeWorld;
+	}
+
+	//! Place the camera target at a world position, moving the origin onto it
+	void setTargetWorld(Camera &camera, double x, double y, double z)
+	{
+		m_origin[0] = x;
+		m_origin[1] = y;
+		m_origin[2] = z;
+		camera.m_target = vmVector3(0.0f);
+		camera.updateViewMatrix();
+		update(camera);
+	}
+
+	//! Convert a world position to the camera's local float space
+	vmVector3 toLocal(double x, double y, double z) const
+	{
+		return vmVector3((float)(x - m_origin[0]), (float)(y - m_origin[1]), (float)(z - m_origin[2]));
+	}
+
+	/*!
+		Call after the camera moved. Rebases the origin onto the eye when the camera
+		drifted beyond the rebase distance; returns true in that case.
+	*/
+	bool update(Camera &camera)
+	{
+		bool rebased = false;
+
+		if(lengthSqr(camera.m_eye) > m_rebaseDistance * m_rebaseDistance)
+		{
+			vmVector3 shift = camera.m_eye;
+			for(int i=0; i<3; ++i)
+			{
+				m_origin[i] += (double)(float)shift[i];
+			}
+			camera.m_target -= shift;
+			camera.updateViewMatrix();
+			rebased = true;
+		}
+
+		for(int i=0; i<3; ++i)
+		{
+			m_eyeWorld[i] = m_origin[i] + (double)(float)camera.m_eye[i];
+		}
+
+		// rotation only, the eye sits at the origin of camera-relative space
+		m_viewMatrix = camera.getViewMatrix();
+		m_viewMatrix.setTranslation(vmVector3(0.0f));
+
+		return rebased;
+	}
+
+	//! View matrix with zero translation
+	const vmMatrix4& getViewMatrix() const
+	{
+		return m_viewMatrix;
+	}
+
+	/*!
+		Batch rebase of world positions (xyz doubles, 'stride' doubles apart)
+		to float32 positions relative to the camera eye.
+	*/
+	void rebaseTranslations(const double *world, size_t stride, float *relative, size_t count) const
+	{
+		const double ex = m_eyeWorld[0];
+		const double ey = m_eyeWorld[1];
+		const double ez = m_eyeWorld[2];
+
+		for(size_t n=0; n<count; ++n)
+		{
+			const double *p = world + n * stride;
+			relative[n*3+0] = (float)(p[0] - ex);
+			relative[n*3+1] = (float)(p[1] - ey);
+			relative[n*3+2] = (float)(p[2] - ez);
+		}
+	}
+
+	/*!
+		Batch rebase of object transforms: 'rotations' hold the float upper 3x3,
+		'world' the double translations; writes camera-relative float matrices.
+	*/
+	void rebaseTransforms(const vmMatrix3 *rotations, const double *world, size_t stride, vmMatrix4 *transforms, size_t count) const
+	{
+		const double ex = m_eyeWorld[0];
+		const double ey = m_eyeWorld[1];
+		const double ez = m_eyeWorld[2];
+
+		for(size_t n=0; n<count; ++n)
+		{
+			const double *p = world + n * stride;
+			vmVector3 translation((float)(p[0] - ex), (float)(p[1] - ey), (float)(p[2] - ez));
+			transforms[n] = vmMatrix4(rotations[n], translation);
+		}
+	}
+
+protected:
+	vmMatrix4	m_viewMatrix;
+
+	double	m_origin[3];
+	double	m_eyeWorld[3];
+	float	m_rebaseDistance;
+};
@@ -0,0 +1,108 @@
+/*!
+	@brief Lock-free camera snapshot shared between UI and render threads
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+#include "../common/atomic.h"
+
+//! Everything the renderer needs from a Camera
+ATTRIBUTE_ALIGNED16_CLASS(struct CameraSnapshot)
+{
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	vmMatrix4	viewMatrix;
+	vmMatrix4	projMatrix;
+	vmVector3	eye;
+
+	float	fovx;
+	float	aspect;
+	float	znear;
+	float	zfar;
+
+	//! publish count, 0 until the first publish
+	unsigned int	version;
+
+	void assign(const Camera &camera)
+	{
+		viewMatrix = camera.m_viewMatrix;
+		projMatrix = camera.m_projMatrix;
+		eye = camera.m_eye;
+		fovx = camera.m_fovx;
+		aspect = camera.m_aspect;
+		znear = camera.m_znear;
+		zfar = camera.m_zfar;
+	}
+};
+
+//! Sequence lock: one writer never waits, readers retry while a write is in flight
+ATTRIBUTE_ALIGNED16_CLASS(class CameraSnapshotBuffer)
+{
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	CameraSnapshotBuffer() : m_sequence(0), m_version(0)
+	{
+		// readers may come before the first publish
+		m_snapshot.viewMatrix = vmMatrix4::identity();
+		m_snapshot.projMatrix = vmMatrix4::identity();
+		m_snapshot.eye = vmVector3(0.0f);
+		m_snapshot.fovx = 0.0f;
+		m_snapshot.aspect = 0.0f;
+		m_snapshot.znear = 0.0f;
+		m_snapshot.zfar = 0.0f;
+		m_snapshot.version = 0;
+	}
+
+	//! Writer side, a single thread only
+	void publish(const Camera &camera)
+	{
+		int seq = m_sequence.loadRelaxed();
+		m_sequence.store(seq + 1);		// odd: write in progress
+		atomicReleaseFence();
+
+		m_snapshot.assign(camera);
+		m_snapshot.version = ++m_version;
+
+		m_sequence.store(seq + 2);		// even: consistent
+	}
+
+	//! Single attempt; false if a write was in progress
+	bool tryRead(CameraSnapshot &out) const
+	{
+		int before = m_sequence.load();
+		if(before & 1) return false;
+
+		out = m_snapshot;
+
+		atomicAcquireFence();
+		return m_sequence.loadRelaxed() == before;
+	}
+
+	//! Reader side, any number of threads
+	void read(CameraSnapshot &out) const
+	{
+		while(!tryRead(out))
+		{
+#ifdef _MSC_VER
+			YieldProcessor();
+#elif defined(BT_USE_SSE)
+			_mm_pause();
+#endif
+		}
+	}
+
+	//! Version of the last completed publish
+	unsigned int version() const
+	{
+		return (unsigned int)m_sequence.load() >> 1;
+	}
+
+protected:
+	CameraSnapshot	m_snapshot;
+	AtomicInt		m_sequence;
+	unsigned int	m_version;
+};
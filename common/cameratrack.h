@@ -0,0 +1,459 @@
+/*!
+	@brief Camera flythrough recording and playback
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+
+#include <cstring>
+#include <fstream>
+
+//! One sample of the orbit camera state
+struct CameraTrackKey
+{
+	float	time;
+	float	target[3];
+	float	orientation[4];
+	float	centerOfInterest;
+
+	//! Same camera state, the time is not compared
+	bool sameState(const CameraTrackKey &other) const
+	{
+		return memcmp(target, other.target, sizeof(CameraTrackKey) - sizeof(float)) == 0;
+	}
+};
+
+//! Sequence of camera samples with a compact binary file format
+class CameraTrack
+{
+public:
+	enum
+	{
+		FILE_MAGIC = 0x4b525443,	// 'CTRK'
+		FILE_VERSION = 1,
+	};
+
+	struct FileHeader
+	{
+		unsigned int	magic;
+		unsigned int	version;
+		unsigned int	keyCount;
+		unsigned int	keySize;
+	};
+
+	void clear()
+	{
+		m_keys.clear();
+	}
+
+	bool empty() const
+	{
+		return m_keys.empty();
+	}
+
+	size_t size() const
+	{
+		return m_keys.size();
+	}
+
+	const CameraTrackKey& operator[](size_t n) const
+	{
+		return m_keys[n];
+	}
+
+	void push_back(const CameraTrackKey &key)
+	{
+		m_keys.push_back(key);
+	}
+
+	const CameraTrackKey& back() const
+	{
+		return m_keys.back();
+	}
+
+	//! Index of the last key at or before 'time'
+	size_t findKey(float time) const
+	{
+		if(m_keys.empty()) return 0;
+
+		CameraTrackKey key;
+		key.time = time;
+		std::vector<CameraTrackKey>::const_iterator it = std::upper_bound(m_keys.begin(), m_keys.end(), key, earlier);
+		return (it == m_keys.begin()) ? 0 : (size_t)(it - m_keys.begin()) - 1;
+	}
+
+	float startTime() const
+	{
+		return m_keys.empty() ? 0.0f : m_keys.front().time;
+	}
+
+	float duration() const
+	{
+		return m_keys.empty() ? 0.0f : m_keys.back().time - m_keys.front().time;
+	}
+
+	bool save(const char *fileName) const
+	{
+		std::ofstream ofs(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+		if(!ofs) return false;
+
+		FileHeader header;
+		header.magic = FILE_MAGIC;
+		header.version = FILE_VERSION;
+		header.keyCount = (unsigned int)m_keys.size();
+		header.keySize = sizeof(CameraTrackKey);
+
+		ofs.write((const char*)&header, sizeof(header));
+		if(!m_keys.empty())
+		{
+			ofs.write((const char*)&m_keys[0], m_keys.size() * sizeof(CameraTrackKey));
+		}
+		return ofs.good();
+	}
+
+	bool load(const char *fileName)
+	{
+		std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+		if(!ifs) return false;
+
+		FileHeader header;
+		if(!ifs.read((char*)&header, sizeof(header))) return false;
+		if(header.magic != FILE_MAGIC || header.version != FILE_VERSION) return false;
+		if(header.keySize != sizeof(CameraTrackKey)) return false;
+
+		// a truncated or corrupt header must not size the allocation
+		std::streamoff start = ifs.tellg();
+		if(!ifs.seekg(0, std::ios::end)) return false;
+		std::streamoff remaining = ifs.tellg() - start;
+		if(remaining < 0 || (unsigned long long)remaining / sizeof(CameraTrackKey) < header.keyCount) return false;
+		ifs.seekg(start);
+
+		std::vector<CameraTrackKey> keys(header.keyCount);
+		if(!keys.empty() && !ifs.read((char*)&keys[0], keys.size() * sizeof(CameraTrackKey))) return false;
+
+		m_keys.swap(keys);
+		return true;
+	}
+
+protected:
+	static bool earlier(const CameraTrackKey &a, const CameraTrackKey &b)
+	{
+		return a.time < b.time;
+	}
+
+	std::vector<CameraTrackKey>	m_keys;
+};
+
+//! Samples m_target, m_orientation and m_centerOfInterest of a camera
+class CameraTrackRecorder
+{
+public:
+	CameraTrackRecorder() : m_recording(false), m_holding(false) {}
+
+	void start()
+	{
+		m_track.clear();
+		m_recording = true;
+		m_holding = false;
+	}
+
+	void stop()
+	{
+		// close a trailing hold so playback keeps its full length
+		if(m_recording && m_holding)
+		{
+			m_track.push_back(m_heldKey);
+		}
+		m_recording = false;
+		m_holding = false;
+	}
+
+	bool isRecording() const
+	{
+		return m_recording;
+	}
+
+	const CameraTrack& track() const
+	{
+		return m_track;
+	}
+
+	//! Unchanged samples are collapsed, only the end of a hold is stored
+	void sample(double time, const Camera &camera)
+	{
+		if(!m_recording) return;
+
+		CameraTrackKey key;
+		makeKey(key, (float)time, camera);
+
+		if(!m_track.empty() && key.sameState(m_track.back()))
+		{
+			m_heldKey = key;
+			m_holding = true;
+			return;
+		}
+
+		if(m_holding)
+		{
+			m_track.push_back(m_heldKey);
+			m_holding = false;
+		}
+		m_track.push_back(key);
+	}
+
+	static void makeKey(CameraTrackKey &key, float time, const Camera &camera)
+	{
+		key.time = time;
+		for(int i=0; i<3; ++i)
+		{
+			key.target[i] = camera.m_target[i];
+		}
+		for(int i=0; i<4; ++i)
+		{
+			key.orientation[i] = camera.m_orientation[i];
+		}
+		key.centerOfInterest = camera.m_centerOfInterest;
+	}
+
+protected:
+	CameraTrack		m_track;
+	CameraTrackKey	m_heldKey;
+	bool			m_recording;
+	bool			m_holding;
+};
+
+//! Replays a CameraTrack at a fixed timestep
+class CameraTrackPlayer
+{
+public:
+	CameraTrackPlayer() : m_playing(false), m_step(1.0 / 60.0), m_time(0.0) {}
+
+	bool load(const char *fileName)
+	{
+		if(!m_track.load(fileName)) return false;
+		prepare();
+		return true;
+	}
+
+	void setTrack(const CameraTrack &track)
+	{
+		m_track = track;
+		prepare();
+	}
+
+	//! Start playback, advancing 'step' seconds of track time per frame
+	void start(double step)
+	{
+		m_step = step;
+		m_time = m_track.startTime();
+		m_playing = !m_track.empty();
+		m_frameTimes.clear();
+		m_frameTimes.reserve((size_t)(m_track.duration() / step) + 2);
+	}
+
+	void stop()
+	{
+		m_playing = false;
+	}
+
+	bool isPlaying() const
+	{
+		return m_playing;
+	}
+
+	double time() const
+	{
+		return m_time;
+	}
+
+	//! Apply the current frame to the camera and advance; false once the track ended
+	bool step(Camera &camera)
+	{
+		if(!m_playing) return false;
+
+		evaluate(m_time, camera);
+
+		if(m_time >= m_track.startTime() + m_track.duration())
+		{
+			m_playing = false;
+		}
+		m_time += m_step;
+		return true;
+	}
+
+	/*!
+		Catmull-Rom on target and distance, squad on orientation. Keys that
+		start or end a hold get zero velocity, so the camera neither drifts
+		during the hold nor overshoots into it.
+	*/
+	void evaluate(double time, Camera &camera) const
+	{
+		if(m_track.empty()) return;
+
+		size_t last = m_track.size() - 1;
+		size_t i = m_track.findKey((float)time);
+
+		size_t i0 = (i > 0) ? i - 1 : 0;
+		size_t i2 = (i < last) ? i + 1 : last;
+		size_t i3 = (i2 < last) ? i2 + 1 : last;
+
+		const CameraTrackKey &k0 = m_track[i0];
+		const CameraTrackKey &k1 = m_track[i];
+		const CameraTrackKey &k2 = m_track[i2];
+		const CameraTrackKey &k3 = m_track[i3];
+
+		float t = 0.0f;
+		float span = k2.time - k1.time;
+		if(span > 0.0f)
+		{
+			t = std::min(std::max((float)(time - k1.time) / span, 0.0f), 1.0f);
+		}
+
+		bool stop1 = m_held[i];
+		bool stop2 = m_held[i2];
+
+		camera.m_target = vmVector3(
+			catmullRom(t, k0.target[0], k1.target[0], k2.target[0], k3.target[0], stop1, stop2),
+			catmullRom(t, k0.target[1], k1.target[1], k2.target[1], k3.target[1], stop1, stop2),
+			catmullRom(t, k0.target[2], k1.target[2], k2.target[2], k3.target[2], stop1, stop2) );
+
+		camera.m_centerOfInterest = catmullRom(t, k0.centerOfInterest, k1.centerOfInterest, k2.centerOfInterest, k3.centerOfInterest, stop1, stop2);
+
+		camera.m_orientation = squad(t, m_orientations[i].get(), m_controls[i].get(), m_controls[i2].get(), m_orientations[i2].get());
+		camera.updateViewMatrix();
+	}
+
+	//! Frame time of the frame rendered with the last step()
+	void recordFrameTime(double milliseconds)
+	{
+		m_frameTimes.push_back((float)milliseconds);
+	}
+
+	const std::vector<float>& frameTimes() const
+	{
+		return m_frameTimes;
+	}
+
+	//! Write one frame time in milliseconds per line
+	bool dumpFrameTimes(const char *fileName) const
+	{
+		std::ofstream ofs(fileName, std::ios::out | std::ios::trunc);
+		if(!ofs) return false;
+
+		ofs << "frame,track_time,frame_ms\n";
+		for(size_t n=0; n<m_frameTimes.size(); ++n)
+		{
+			ofs << n << "," << m_track.startTime() + n * m_step << "," << m_frameTimes[n] << "\n";
+		}
+		return ofs.good();
+	}
+
+	//! Uniform Catmull-Rom from p1 to p2; stop1/stop2 replace the tangent at p1/p2 with zero
+	static float catmullRom(float t, float p0, float p1, float p2, float p3, bool stop1 = false, bool stop2 = false)
+	{
+		float m1 = stop1 ? 0.0f : 0.5f * (p2 - p0);
+		float m2 = stop2 ? 0.0f : 0.5f * (p3 - p1);
+
+		float t2 = t * t;
+		float t3 = t2 * t;
+		return	(2.0f * t3 - 3.0f * t2 + 1.0f) * p1 +
+				(t3 - 2.0f * t2 + t) * m1 +
+				(-2.0f * t3 + 3.0f * t2) * p2 +
+				(t3 - t2) * m2;
+	}
+
+	//! log of a unit quaternion (w component is zero)
+	static vmQuat quatLog(const vmQuat &q)
+	{
+		vmVector3 v = q.getXYZ();
+		float s = length(v);
+		float w = std::min(std::max((float)q.getW(), -1.0f), 1.0f);
+		if(s < SIMD_EPSILON) return vmQuat(0.0f, 0.0f, 0.0f, 0.0f);
+		float angle = atan2f(s, w);
+		return vmQuat(v * (angle / s), 0.0f);
+	}
+
+	//! exp of a pure quaternion
+	static vmQuat quatExp(const vmQuat &q)
+	{
+		vmVector3 v = q.getXYZ();
+		float angle = length(v);
+		if(angle < SIMD_EPSILON) return vmQuat::identity();
+		return vmQuat(v * (sinf(angle) / angle), cosf(angle));
+	}
+
+protected:
+	//! Align hemispheres and build squad control points
+	void prepare()
+	{
+		size_t count = m_track.size();
+		m_orientations.resize(count);
+		m_controls.resize(count);
+		m_held.resize(count);
+		m_playing = false;
+
+		for(size_t n=0; n<count; ++n)
+		{
+			m_held[n] = (n > 0 && m_track[n].sameState(m_track[n-1])) ||
+						(n + 1 < count && m_track[n].sameState(m_track[n+1]));
+		}
+
+		for(size_t n=0; n<count; ++n)
+		{
+			const float *o = m_track[n].orientation;
+			vmQuat q = normalize(vmQuat(o[0], o[1], o[2], o[3]));
+			if(n > 0 && dot(m_orientations[n-1].get(), q) < 0.0f)
+			{
+				q = -q;
+			}
+			m_orientations[n].set(q);
+		}
+
+		for(size_t n=0; n<count; ++n)
+		{
+			vmQuat q = m_orientations[n].get();
+			if(m_held[n])
+			{
+				// the control point on the key itself: no angular velocity
+				m_controls[n].set(q);
+				continue;
+			}
+
+			vmQuat prev = m_orientations[(n > 0) ? n - 1 : n].get();
+			vmQuat next = m_orientations[(n + 1 < count) ? n + 1 : n].get();
+			vmQuat inv = conj(q);
+			vmQuat sum = quatLog(inv * next) + quatLog(inv * prev);
+			m_controls[n].set(normalize(q * quatExp(sum * -0.25f)));
+		}
+	}
+
+	//! Unaligned quaternion storage, std::vector cannot hold 16-byte aligned types
+	struct QuatKey
+	{
+		float	v[4];
+
+		vmQuat get() const
+		{
+			return vmQuat(v[0], v[1], v[2], v[3]);
+		}
+
+		void set(const vmQuat &q)
+		{
+			for(int i=0; i<4; ++i) v[i] = q[i];
+		}
+	};
+
+	CameraTrack				m_track;
+	std::vector<QuatKey>	m_orientations;
+	std::vector<QuatKey>	m_controls;
+	//! key starts or ends a hold
+	std::vector<bool>		m_held;
+	std::vector<float>	m_frameTimes;
+
+	bool	m_playing;
+	double	m_step;
+	double	m_time;
+};
@@ -0,0 +1,120 @@
+/*!
+	@brief Compact orbit camera for large camera sets
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+
+//! Orbit camera reduced to its free parameters; axes and matrices are derived on demand
+ATTRIBUTE_ALIGNED16_CLASS(struct CompactCamera)
+{
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	//! unit quaternion, same convention as Camera::m_orientation
+	vmQuat	orientation;
+
+	float	target[3];
+	float	distance;
+
+	float	fovx;
+	float	aspect;
+	float	znear;
+	float	zfar;
+
+	void assign(const Camera &camera)
+	{
+		orientation = normalize(camera.m_orientation);
+		for(int i=0; i<3; ++i)
+		{
+			target[i] = camera.m_target[i];
+		}
+		distance = camera.m_centerOfInterest;
+		fovx = camera.m_fovx;
+		aspect = camera.m_aspect;
+		znear = camera.m_znear;
+		zfar = camera.m_zfar;
+	}
+
+	//! Expand into a full Camera
+	void expand(Camera &camera) const
+	{
+		camera.m_orientation = orientation;
+		camera.m_target = getTarget();
+		camera.m_centerOfInterest = distance;
+		camera.m_fovx = fovx;
+		camera.m_aspect = aspect;
+		camera.m_znear = znear;
+		camera.m_zfar = zfar;
+		camera.updateViewMatrix();
+		camera.updateProjectionMatrix();
+	}
+
+	vmVector3 getTarget() const
+	{
+		return vmVector3(target[0], target[1], target[2]);
+	}
+
+	//! Row 0 of the view rotation
+	vmVector3 getXAxis() const
+	{
+		float x = orientation[0], y = orientation[1], z = orientation[2], w = orientation[3];
+		return vmVector3(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z), 2.0f * (x * z + w * y));
+	}
+
+	//! Row 1 of the view rotation
+	vmVector3 getYAxis() const
+	{
+		float x = orientation[0], y = orientation[1], z = orientation[2], w = orientation[3];
+		return vmVector3(2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z - w * x));
+	}
+
+	//! Row 2 of the view rotation, also the view direction
+	vmVector3 getZAxis() const
+	{
+		float x = orientation[0], y = orientation[1], z = orientation[2], w = orientation[3];
+		return vmVector3(2.0f * (x * z - w * y), 2.0f * (y * z + w * x), 1.0f - 2.0f * (x * x + y * y));
+	}
+
+	vmVector3 getViewDir() const
+	{
+		return getZAxis();
+	}
+
+	vmVector3 getEye() const
+	{
+		return getTarget() - getZAxis() * distance;
+	}
+
+	//! Same result as Camera::updateViewMatrix()
+	void buildViewMatrix(vmMatrix4 &viewMatrix) const
+	{
+		viewMatrix = vmMatrix4::rotation(orientation);
+
+		vmVector3 eye = getTarget() - viewMatrix.getRow(2).getXYZ() * distance;
+		vmVector3 translation = -(viewMatrix.getUpper3x3() * eye);
+		viewMatrix.setTranslation(translation);
+	}
+
+	//! Same result as Camera::updateProjectionMatrix()
+	void buildProjMatrix(vmMatrix4 &projMatrix) const
+	{
+		float e = 1.0f / tanf(btRadians(fovx) / 2.0f);
+		float aspectInv = 1.0f / aspect;
+		float fovy = 2.0f * atanf(aspectInv / e);
+		float xScale = 1.0f / tanf(0.5f * fovy);
+		float yScale = xScale / aspectInv;
+		float zScale = zfar / (zfar - znear);
+
+		projMatrix = vmMatrix4(
+			vmVector4(xScale, 0.0f, 0.0f, 0.0f),
+			vmVector4(0.0f, yScale, 0.0f, 0.0f),
+			vmVector4(0.0f, 0.0f, zScale, 1.0f),
+			vmVector4(0.0f, 0.0f, -znear * zScale, 0.0f) );
+	}
+};
+
+//! Compile-time size budget: a quaternion plus two float4 rows of parameters
+typedef char CompactCameraSizeCheck[(sizeof(CompactCamera) <= 48) ? 1 : -1];
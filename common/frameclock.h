@@ -0,0 +1,167 @@
+/*!
+	@brief Fixed-timestep frame clock
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/timer.h"
+
+/*!
+	Advances simulated time in fixed steps driven by the high resolution timer.
+	Wall time that does not fill a whole step stays in the accumulator and is
+	exposed as an interpolation alpha for rendering between two steps.
+*/
+class FrameClock
+{
+public:
+	FrameClock() :
+		m_step(1.0 / 60.0),
+		m_targetRate(60.0),
+		m_maxFrameTime(0.25),
+		m_accumulator(0.0),
+		m_simulationTime(0.0),
+		m_frameTime(0.0),
+		m_frameCount(0),
+		m_running(false)
+	{
+	}
+
+	//! Simulation step in seconds
+	void setFixedStep(double step)
+	{
+		m_step = std::max(step, 1.0e-4);
+	}
+
+	double getFixedStep() const
+	{
+		return m_step;
+	}
+
+	//! Frames per second to tick at, 0 for uncapped
+	void setTargetRate(double hz)
+	{
+		m_targetRate = std::max(hz, 0.0);
+	}
+
+	double getTargetRate() const
+	{
+		return m_targetRate;
+	}
+
+	bool isUncapped() const
+	{
+		return m_targetRate <= 0.0;
+	}
+
+	//! Longest wall time one tick() may consume; longer stalls are dropped instead of caught up
+	void setMaxFrameTime(double seconds)
+	{
+		m_maxFrameTime = std::max(seconds, m_step);
+	}
+
+	//! Interval for a QTimer driving tick(); 0 runs whenever the event loop is idle
+	int getTimerInterval() const
+	{
+		if(isUncapped()) return 0;
+		return std::max(1, (int)floor(1000.0 / m_targetRate));
+	}
+
+	//! Back to time zero
+	void reset()
+	{
+		m_accumulator = 0.0;
+		m_simulationTime = 0.0;
+		m_frameTime = 0.0;
+		m_frameCount = 0;
+		m_timer.reset();
+	}
+
+	//! Continue after a pause without counting the paused wall time
+	void resume()
+	{
+		m_running = true;
+		m_timer.reset();
+	}
+
+	void pause()
+	{
+		m_running = false;
+	}
+
+	bool isRunning() const
+	{
+		return m_running;
+	}
+
+	//! Consume the wall time since the last tick; returns how many fixed steps to simulate
+	int tick()
+	{
+		double elapsed = m_timer.seconds();
+		m_timer.reset();
+		return advance(elapsed);
+	}
+
+	//! Same as tick() with a given wall time, for headless runs that step a fixed amount per frame
+	int advance(double seconds)
+	{
+		m_frameTime = std::min(seconds, m_maxFrameTime);
+		++m_frameCount;
+
+		if(!m_running) return 0;
+
+		m_accumulator += m_frameTime;
+
+		int steps = 0;
+		while(m_accumulator >= m_step)
+		{
+			m_accumulator -= m_step;
+			m_simulationTime += m_step;
+			++steps;
+		}
+		return steps;
+	}
+
+	//! Time at the last completed step
+	double getTime() const
+	{
+		return m_simulationTime;
+	}
+
+	//! Fraction of the next step already elapsed, in [0,1)
+	double getAlpha() const
+	{
+		return m_accumulator / m_step;
+	}
+
+	//! Time to render at, between the last step and the next one
+	double getInterpolatedTime() const
+	{
+		return m_simulationTime + m_accumulator;
+	}
+
+	//! Wall time of the last tick (after clamping)
+	double getFrameTime() const
+	{
+		return m_frameTime;
+	}
+
+	unsigned int getFrameCount() const
+	{
+		return m_frameCount;
+	}
+
+protected:
+	HighResolutionTimer	m_timer;
+
+	double	m_step;
+	double	m_targetRate;
+	double	m_maxFrameTime;
+	double	m_accumulator;
+	double	m_simulationTime;
+	double	m_frameTime;
+
+	unsigned int	m_frameCount;
+	bool			m_running;
+};
@@ -0,0 +1,215 @@
+/*!
+	@brief Per-frame CPU time statistics
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/timer.h"
+
+#include <cstdio>
+
+/*!
+	Ring buffers of the last HISTORY frame times for each phase, with rolling
+	percentiles. Each phase has a single writer thread; reading from another
+	thread may see a sample being overwritten, which only blurs the statistics.
+*/
+class FrameStats
+{
+public:
+	enum Phase
+	{
+		PHASE_UPDATE = 0,	//!< UI side: input, camera, scheduling
+		PHASE_RENDER,		//!< render(), without the present() it calls
+		PHASE_PRESENT,		//!< present()
+		PHASE_COUNT,
+	};
+
+	enum
+	{
+		HISTORY = 512,
+	};
+
+	struct Summary
+	{
+		int		count;
+		double	p50;
+		double	p95;
+		double	p99;
+		double	max;
+	};
+
+	//! Times a phase from construction to destruction
+	class Scope
+	{
+	public:
+		Scope(FrameStats &stats, Phase phase) : m_stats(stats), m_phase(phase)
+		{
+			m_stats.begin(m_phase);
+		}
+
+		~Scope()
+		{
+			m_stats.record(m_phase, m_timer.milliseconds());
+		}
+
+	private:
+		FrameStats&			m_stats;
+		Phase				m_phase;
+		HighResolutionTimer	m_timer;
+
+		Scope& operator=(const Scope&);
+	};
+
+	FrameStats() : m_presentInRender(0.0)
+	{
+		for(int p=0; p<PHASE_COUNT; ++p)
+		{
+			for(int i=0; i<HISTORY; ++i)
+			{
+				m_samples[p][i] = 0.0f;
+			}
+		}
+	}
+
+	/*!
+		Start of a timed phase. A render phase forgets presents from earlier
+		render() calls outside any render scope, e.g. from onResize or track
+		playback.
+	*/
+	void begin(Phase phase)
+	{
+		if(phase == PHASE_RENDER)
+		{
+			m_presentInRender = 0.0;
+		}
+	}
+
+	/*!
+		Add one sample in milliseconds. present() runs inside render(), so the
+		present time seen since the render phase began is taken out of it.
+	*/
+	void record(Phase phase, double milliseconds)
+	{
+		if(phase == PHASE_PRESENT)
+		{
+			m_presentInRender += milliseconds;
+		}
+		else if(phase == PHASE_RENDER)
+		{
+			milliseconds = std::max(milliseconds - m_presentInRender, 0.0);
+			m_presentInRender = 0.0;
+		}
+
+		int count = m_count[phase].loadRelaxed();
+		m_samples[phase][count % HISTORY] = (float)milliseconds;
+		m_count[phase].store(count + 1);
+	}
+
+	//! Samples recorded so far, including the ones already overwritten
+	int count(Phase phase) const
+	{
+		return m_count[phase].load();
+	}
+
+	//! Percentiles over the samples still in the ring
+	Summary summarize(Phase phase) const
+	{
+		Summary summary = { 0, 0.0, 0.0, 0.0, 0.0 };
+
+		std::vector<float> sorted;
+		copySamples(phase, sorted);
+		if(sorted.empty()) return summary;
+
+		std::sort(sorted.begin(), sorted.end());
+		summary.count = (int)sorted.size();
+		summary.p50 = percentile(sorted, 0.50);
+		summary.p95 = percentile(sorted, 0.95);
+		summary.p99 = percentile(sorted, 0.99);
+		summary.max = sorted.back();
+		return summary;
+	}
+
+	//! One line for a status bar
+	std::string format() const
+	{
+		static const char *names[PHASE_COUNT] = { "update", "render", "present" };
+
+		std::ostringstream stream;
+		stream.setf(std::ios::fixed);
+		stream.precision(2);
+
+		for(int p=0; p<PHASE_COUNT; ++p)
+		{
+			Summary s = summarize((Phase)p);
+			if(p > 0) stream << "  |  ";
+			stream << names[p] << " p50 " << s.p50 << " p95 " << s.p95 << " p99 " << s.p99 << " max " << s.max;
+		}
+		stream << " ms";
+		return stream.str();
+	}
+
+	//! Write the samples in the rings, oldest first, one phase per column
+	bool dumpCsv(const char *filename) const
+	{
+		FILE *fp = fopen(filename, "w");
+		if(!fp) return false;
+
+		std::vector<float> samples[PHASE_COUNT];
+		size_t rows = 0;
+		for(int p=0; p<PHASE_COUNT; ++p)
+		{
+			copySamples((Phase)p, samples[p]);
+			rows = std::max(rows, samples[p].size());
+		}
+
+		fprintf(fp, "sample,update_ms,render_ms,present_ms\n");
+		for(size_t n=0; n<rows; ++n)
+		{
+			fprintf(fp, "%u", (unsigned int)n);
+			for(int p=0; p<PHASE_COUNT; ++p)
+			{
+				if(n < samples[p].size())
+				{
+					fprintf(fp, ",%.4f", samples[p][n]);
+				}
+				else
+				{
+					fprintf(fp, ",");
+				}
+			}
+			fprintf(fp, "\n");
+		}
+
+		fclose(fp);
+		return true;
+	}
+
+protected:
+	void copySamples(Phase phase, std::vector<float> &samples) const
+	{
+		int count = m_count[phase].load();
+		int n = std::min(count, (int)HISTORY);
+
+		samples.resize(n);
+		for(int i=0; i<n; ++i)
+		{
+			samples[i] = m_samples[phase][(count - n + i) % HISTORY];
+		}
+	}
+
+	//! nearest-rank percentile of sorted samples
+	static double percentile(const std::vector<float> &sorted, double fraction)
+	{
+		size_t rank = (size_t)ceil(fraction * (double)sorted.size());
+		return sorted[std::max(rank, (size_t)1) - 1];
+	}
+
+	float		m_samples[PHASE_COUNT][HISTORY];
+	AtomicInt	m_count[PHASE_COUNT];
+
+	//! present time inside the current render(), render thread only
+	double		m_presentInRender;
+};
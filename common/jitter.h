@@ -0,0 +1,226 @@
+/*!
+	@brief Sub-pixel jitter sequences and jittered projection for temporal upsampling
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+
+//! Radical inverse of Index in Base as an exact fraction, evaluated by the compiler
+template<int Base, int Index>
+struct RadicalInverse
+{
+	typedef RadicalInverse<Base, Index / Base> Next;
+	enum
+	{
+		denominator = Base * Next::denominator,
+		numerator = (Index % Base) * Next::denominator + Next::numerator,
+	};
+};
+
+template<int Base>
+struct RadicalInverse<Base, 0>
+{
+	enum
+	{
+		denominator = 1,
+		numerator = 0,
+	};
+};
+
+#define HALTON_RI(b,i)	((float)RadicalInverse<b,i>::numerator / (float)RadicalInverse<b,i>::denominator - 0.5f)
+#define HALTON_23(i)	{ HALTON_RI(2,i), HALTON_RI(3,i) }
+
+//! Sub-pixel offsets in [-0.5, 0.5)
+class JitterSequence
+{
+public:
+	enum
+	{
+		HALTON_TABLE_SIZE = 32,
+	};
+
+	//! Halton(2,3), 1-based so the first sample is not the pixel center; constant table for the first 32
+	static void halton23(unsigned int index, float &x, float &y)
+	{
+		static const float table[HALTON_TABLE_SIZE][2] =
+		{
+			HALTON_23(1),  HALTON_23(2),  HALTON_23(3),  HALTON_23(4),
+			HALTON_23(5),  HALTON_23(6),  HALTON_23(7),  HALTON_23(8),
+			HALTON_23(9),  HALTON_23(10), HALTON_23(11), HALTON_23(12),
+			HALTON_23(13), HALTON_23(14), HALTON_23(15), HALTON_23(16),
+			HALTON_23(17), HALTON_23(18), HALTON_23(19), HALTON_23(20),
+			HALTON_23(21), HALTON_23(22), HALTON_23(23), HALTON_23(24),
+			HALTON_23(25), HALTON_23(26), HALTON_23(27), HALTON_23(28),
+			HALTON_23(29), HALTON_23(30), HALTON_23(31), HALTON_23(32),
+		};
+
+		if(index < HALTON_TABLE_SIZE)
+		{
+			x = table[index][0];
+			y = table[index][1];
+		}
+		else
+		{
+			x = radicalInverse(index + 1, 2) - 0.5f;
+			y = radicalInverse(index + 1, 3) - 0.5f;
+		}
+	}
+
+	//! R2 low-discrepancy sequence (generalised golden ratio)
+	static void r2(unsigned int index, float &x, float &y)
+	{
+		// 1/g and 1/g^2, g = plastic number 1.32471795724474602596
+		const double a1 = 0.75487766624669276005;
+		const double a2 = 0.56984029099805326591;
+		double fx = 0.5 + a1 * (double)index;
+		double fy = 0.5 + a2 * (double)index;
+		x = (float)(fx - floor(fx)) - 0.5f;
+		y = (float)(fy - floor(fy)) - 0.5f;
+	}
+
+	static float radicalInverse(unsigned int index, unsigned int base)
+	{
+		float invBase = 1.0f / (float)base;
+		float fraction = invBase;
+		float result = 0.0f;
+		while(index > 0)
+		{
+			result += (float)(index % base) * fraction;
+			index /= base;
+			fraction *= invBase;
+		}
+		return result;
+	}
+};
+
+#undef HALTON_23
+#undef HALTON_RI
+
+//! Jittered projection with the matrices temporal reconstruction needs
+ATTRIBUTE_ALIGNED16_CLASS(class TemporalJitter)
+{
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	enum Sequence
+	{
+		SEQUENCE_HALTON23 = 0,
+		SEQUENCE_R2,
+	};
+
+	TemporalJitter() :
+		m_sequence(SEQUENCE_HALTON23),
+		m_frameIndex(0),
+		m_phaseCount(8),
+		m_renderWidth(1), m_renderHeight(1),
+		m_jitterX(0.0f), m_jitterY(0.0f),
+		m_hasHistory(false)
+	{
+		m_projMatrix = m_unjitteredProjMatrix = vmMatrix4::identity();
+		m_viewProjMatrix = m_prevViewProjMatrix = vmMatrix4::identity();
+	}
+
+	void setSequence(Sequence sequence)
+	{
+		m_sequence = sequence;
+	}
+
+	//! Render target and output size; the phase count grows with the display pixels per render pixel
+	void setResolution(unsigned int renderWidth, unsigned int renderHeight, unsigned int displayWidth, unsigned int displayHeight)
+	{
+		m_renderWidth = std::max(renderWidth, 1u);
+		m_renderHeight = std::max(renderHeight, 1u);
+
+		float scaleX = (float)std::max(displayWidth, 1u) / (float)m_renderWidth;
+		float scaleY = (float)std::max(displayHeight, 1u) / (float)m_renderHeight;
+		m_phaseCount = std::max(8, (int)ceilf(8.0f * scaleX * scaleY));
+	}
+
+	//! Drop history, e.g. after a camera cut
+	void reset()
+	{
+		m_frameIndex = 0;
+		m_hasHistory = false;
+	}
+
+	//! Call once per frame after the camera has been updated
+	void update(const Camera &camera)
+	{
+		unsigned int phase = m_frameIndex % m_phaseCount;
+		if(m_sequence == SEQUENCE_R2)
+		{
+			JitterSequence::r2(phase, m_jitterX, m_jitterY);
+		}
+		else
+		{
+			JitterSequence::halton23(phase, m_jitterX, m_jitterY);
+		}
+		++m_frameIndex;
+
+		m_prevViewProjMatrix = m_viewProjMatrix;
+
+		m_unjitteredProjMatrix = camera.getProjMatrix();
+		m_viewProjMatrix = m_unjitteredProjMatrix * camera.getViewMatrix();
+
+		if(!m_hasHistory)
+		{
+			m_prevViewProjMatrix = m_viewProjMatrix;
+			m_hasHistory = true;
+		}
+
+		// constant NDC offset: x' += k * z and w = z; pixel y points down
+		m_projMatrix = m_unjitteredProjMatrix;
+		m_projMatrix[2][0] += 2.0f * m_jitterX / (float)m_renderWidth;
+		m_projMatrix[2][1] -= 2.0f * m_jitterY / (float)m_renderHeight;
+	}
+
+	//! Offset in render target pixels
+	float getJitterX() const { return m_jitterX; }
+	float getJitterY() const { return m_jitterY; }
+
+	unsigned int getPhaseCount() const
+	{
+		return m_phaseCount;
+	}
+
+	//! Projection to render the scene with
+	const vmMatrix4& getProjMatrix() const
+	{
+		return m_projMatrix;
+	}
+
+	const vmMatrix4& getUnjitteredProjMatrix() const
+	{
+		return m_unjitteredProjMatrix;
+	}
+
+	//! Unjittered viewProj of this frame and the previous one, for motion vectors
+	const vmMatrix4& getViewProjMatrix() const
+	{
+		return m_viewProjMatrix;
+	}
+
+	const vmMatrix4& getPrevViewProjMatrix() const
+	{
+		return m_prevViewProjMatrix;
+	}
+
+protected:
+	vmMatrix4	m_projMatrix;
+	vmMatrix4	m_unjitteredProjMatrix;
+	vmMatrix4	m_viewProjMatrix;
+	vmMatrix4	m_prevViewProjMatrix;
+
+	Sequence		m_sequence;
+	unsigned int	m_frameIndex;
+	unsigned int	m_phaseCount;
+	unsigned int	m_renderWidth;
+	unsigned int	m_renderHeight;
+
+	float	m_jitterX;
+	float	m_jitterY;
+	bool	m_hasHistory;
+};
@@ -1,243 +1,490 @@
-/** @file
- * @brief python-like logging
- * @author Shintaro Takemura(stakemura@gmail.com)
- *
- * This code is public domain, no warranty expressed or implied, 
- * Functionality is thought to be correct, but it's up to you to make
- * sure it does what you want.
- */
-
-#pragma once
-#include <vector>
-#include <sstream>
-
-#ifdef  ERROR
-#undef  ERROR
-#endif
-
-//! Python-like logging class
-template<typename T>
-class	logging
-{
-public:
-	//! Logging Level
-	enum Level
-	{
-		TRACE = 0, NOTSET = 0,
-		DEBUG = 10,
-		INFO = 20,
-		WARN = 30, WARNING = 30,
-		ERROR = 40,
-		CRITICAL = 50, FATAL = 50
-	};
-
-	//! Configuration
-	struct Config
-	{
-		//! level
-		Level cntLevel;
-
-		//! log file
-		std::basic_string<T> logFile;
-	};
-
-	//! log_stringbuf
-	template<Level myLevel>
-	class log_stringbuf : public std::basic_stringbuf<T>
-	{
-	public:
-		log_stringbuf(const Config &_p) : config(_p) {}
-
-		virtual ~log_stringbuf()
-		{
-			sync();
-		}
-
-		//! equal to logger.setLevel
-		void setLevel(Level _level)
-		{
-			cntLevel = _level;
-		}
-	protected:
-		virtual int sync()
-		{
-			logging<T>::trace( config, myLevel, str().c_str() );
-			pbump((int)(pbase() - pptr()));
-			return 0;
-		}//sync
-
-		//! Configuration info
-		const Config	&config;
-	};//class log_stringbuf
-
-	//! log_stream
-	template<Level myLevel>
-	class log_stream : public std::basic_ostream<T>
-	{
-	public:
-		log_stream(const Config &_p) :
-			stringbuf(_p),
-			std::basic_ostream<T>(&stringbuf),
-			config(_p) {}
-
-		virtual ~log_stream()
-		{
-			//delete rdbuf();
-		}
-
-		//! Enable logger.xxx call
-		void operator()(const T * fmt, ... )
-		{
-			va_list ap;
-			va_start(ap, fmt);
-
-			temp.resize( logging<T>::_vscprintf(fmt, ap)+1 );
-			
-			logging<T>::_vsnprintf_s(&temp[0], temp.size(), temp.size(), fmt, ap);
-			va_end(ap);
-
-			logging<T>::trace( config, myLevel, &temp[0] );
-		}
-
-	protected:
-		//! Configuration info
-		const Config	&config;
-
-		//! String Buffer
-		log_stringbuf<myLevel>	stringbuf;
-
-		// Temporary Data
-		std::vector<T> temp;
-	};//class log_stream
-
-	logging() :
-		debug(config),
-		info(config),
-		warn(config),
-		error(config),
-		fatal(config)
-	{
-#ifdef _DEBUG
-		setLevel(DEBUG);
-#else
-		setLevel(INFO);
-#endif
-	}
-
-	virtual ~logging() {}
-
-	//! equal to logger.setLevel
-	virtual void setLevel(Level _level)
-	{
-		config.cntLevel = _level;
-	}
-
-	//! limited implement
-	virtual void startConfig(const T* _fname)
-	{
-		if(_fname!=0)
-		{
-			config.logFile = _fname;
-		}
-		else
-		{
-			config.logFile.clear();
-		}
-	}
-
-	//! common output function
-	static void trace(const Config &config, Level myLevel, const T *buf)
-	{
-		if(myLevel<config.cntLevel) return;
-
-		if(config.logFile.empty())
-		{
-			logging<T>::OutputDebugString(buf);
-		}
-		else
-		{
-			FILE *fp = 0;
-			logging<T>::fopen_s(&fp,config.logFile.data());
-			logging<T>::fputs(buf,fp);
-			fclose(fp);
-		}
-	}
-
-	static void OutputDebugString(const T *);
-	static int  _vscprintf( const T * _Format, va_list _ArgList);
-	static void _vsnprintf_s(T * _DstBuf, size_t _SizeInBytes, size_t _MaxCount, const T * _Format, va_list _ArgList);
-	static void fopen_s(FILE ** _File, const T * _FileName);
-	static void fputs(const T * _DstBuf, FILE * _File);
-
-	log_stream<DEBUG>		debug;
-	log_stream<INFO>		info;
-	log_stream<WARN>		warn;
-	log_stream<ERROR>		error;
-	log_stream<FATAL>		fatal;
-
-protected:
-	Config config;
-};//class logging
-
-template <>
-inline void logging<char>::OutputDebugString(const char *str)
-{
-	::OutputDebugStringA(str);
-}
-
-template <>
-inline void logging<wchar_t>::OutputDebugString(const wchar_t *str)
-{
-	::OutputDebugStringW(str);
-}
-
-template <>
-inline int  logging<char>::_vscprintf( const char * _Format, va_list _ArgList)
-{
-	return ::_vscprintf(_Format, _ArgList);
-}
-
-template <>
-inline int  logging<wchar_t>::_vscprintf( const wchar_t * _Format, va_list _ArgList)
-{
-	return ::_vscwprintf(_Format, _ArgList);
-}
-
-template <>
-inline void logging<char>::_vsnprintf_s(char * _DstBuf, size_t _SizeInBytes, size_t _MaxCount, const char * _Format, va_list _ArgList)
-{
-	::_vsnprintf_s(_DstBuf,_SizeInBytes,_MaxCount,_Format,_ArgList);
-}
-
-template <>
-inline void logging<wchar_t>::_vsnprintf_s(wchar_t * _DstBuf, size_t _SizeInBytes, size_t _MaxCount, const wchar_t * _Format, va_list _ArgList)
-{
-	::_vsnwprintf_s(_DstBuf,_SizeInBytes,_MaxCount,_Format,_ArgList);
-}
-
-template <>
-inline void logging<char>::fopen_s(FILE ** _File, const char * _FileName)
-{
-	::fopen_s(_File,_FileName,"at");
-}
-
-template <>
-inline void logging<wchar_t>::fopen_s(FILE ** _File, const wchar_t * _FileName)
-{
-	::_wfopen_s(_File,_FileName, L"at");
-}
-
-template <>
-inline void logging<char>::fputs(const char * _DstBuf, FILE * _File)
-{
-	::fputs(_DstBuf,_File);
-}
-
-template <>
-inline void logging<wchar_t>::fputs(const wchar_t * _DstBuf, FILE * _File)
-{
-	::fputws(_DstBuf,_File);
-}
-
-static logging<char> logger;
-static logging<wchar_t> loggerw;
+/** @file
+ * @brief python-like logging
+ * @author Shintaro Takemura(stakemura@gmail.com)
+ *
+ * This code is public domain, no warranty expressed or implied, 
+ * Functionality is thought to be correct, but it's up to you to make
+ * sure it does what you want.
+ */
+
+#pragma once
+#include <ostream>
+#include <streambuf>
+#include <cstring>
+#include <cerrno>
+#include <cstdio>
+#include <cwchar>
+#include <cstdarg>
+#include <cstdlib>
+
+#include "../common/logsink.h"
+#include "../common/timer.h"
+
+#ifdef  ERROR
+#undef  ERROR
+#endif
+
+//! Levels below this are compiled out of log_stream calls and the LOG_xxx macros
+#ifndef LOGGING_MIN_LEVEL
+#ifdef _DEBUG
+#define LOGGING_MIN_LEVEL 0
+#else
+#define LOGGING_MIN_LEVEL 20
+#endif
+#endif
+
+//! logger.debug("...", args) that skips evaluating args when DEBUG is filtered
+#define LOG_DEBUG(log, ...)	do { if((log).debug.isEnabled()) (log).debug(__VA_ARGS__); } while(0)
+#define LOG_INFO(log, ...)	do { if((log).info.isEnabled()) (log).info(__VA_ARGS__); } while(0)
+#define LOG_WARN(log, ...)	do { if((log).warn.isEnabled()) (log).warn(__VA_ARGS__); } while(0)
+#define LOG_ERROR(log, ...)	do { if((log).error.isEnabled()) (log).error(__VA_ARGS__); } while(0)
+#define LOG_FATAL(log, ...)	do { if((log).fatal.isEnabled()) (log).fatal(__VA_ARGS__); } while(0)
+
+//! LOG_STREAM(logger, debug) << ... ; the operands are not evaluated when the level is filtered, the else keeps an outer if/else intact
+#define LOG_STREAM(log, stream)	if(!(log).stream.isEnabled()) {} else (log).stream
+
+//! LOG_LIMITED(logger, warn, 5, 1000, "...", args): at most 5 records a second from this line, the rest are counted
+#define LOG_LIMITED(log, stream, count, ms, ...)	do { if((log).stream.isEnabled()) { \
+	static log_site _logSite; unsigned int _logSkipped = 0; \
+	if(_logSite.limit((count), (ms), _logSkipped)) { \
+		if(_logSkipped) (log).stream.skipped(__FILE__, __LINE__, _logSkipped, "records suppressed"); \
+		(log).stream(__VA_ARGS__); } } } while(0)
+
+//! LOG_CHANGED(logger, info, state, "...", args): a record only when 'state' differs from this line's last one (initially 0)
+#define LOG_CHANGED(log, stream, key, ...)	do { if((log).stream.isEnabled()) { \
+	static log_site _logSite; unsigned int _logSkipped = 0; \
+	if(_logSite.changed((long long)(key), _logSkipped)) { \
+		if(_logSkipped) (log).stream.skipped(__FILE__, __LINE__, _logSkipped, "repeats collapsed"); \
+		(log).stream(__VA_ARGS__); } } } while(0)
+
+/*!
+	State of one LOG_LIMITED or LOG_CHANGED call site, a zero initialized
+	static next to the call. Deciding costs a counter read and a compare, the
+	message is never formatted or hashed. What was held back is reported
+	with the next record that goes out. Not synchronized: a site used from
+	several threads at once may miscount.
+*/
+struct log_site
+{
+	long long		windowEnd;
+	unsigned int	passed;
+	unsigned int	skipped;
+	long long		key;
+	bool			keyed;
+
+	//! true for the first 'count' calls of each 'ms' window; _skipped receives the calls dropped since the last true
+	bool limit(unsigned int count, unsigned int ms, unsigned int &_skipped)
+	{
+		long long now = HighResolutionTimer::ticks();
+		if(now >= windowEnd)
+		{
+			windowEnd = now + HighResolutionTimer::frequency() * ms / 1000;
+			passed = 0;
+		}
+		if(passed >= count)
+		{
+			++skipped;
+			return false;
+		}
+		++passed;
+		_skipped = skipped;
+		skipped = 0;
+		return true;
+	}
+
+	//! true when _key differs from the previous call; _skipped receives the repeats of the previous key
+	bool changed(long long _key, unsigned int &_skipped)
+	{
+		if(_key == key)
+		{
+			// repeats of the initial 0 were never reported, so they are not counted either
+			if(keyed) ++skipped;
+			return false;
+		}
+		key = _key;
+		keyed = true;
+		_skipped = skipped;
+		skipped = 0;
+		return true;
+	}
+};
+
+//! Python-like logging class
+template<typename T>
+class	logging
+{
+public:
+	//! Logging Level
+	enum Level
+	{
+		TRACE = 0, NOTSET = 0,
+		DEBUG = 10,
+		INFO = 20,
+		WARN = 30, WARNING = 30,
+		ERROR = 40,
+		CRITICAL = 50, FATAL = 50
+	};
+
+	enum
+	{
+		//! Characters a logger.xxx() call formats, longer messages are truncated
+		STAGING = 1024,
+	};
+
+	//! Configuration
+	struct Config
+	{
+		//! level
+		Level cntLevel;
+
+		//! log file
+		std::basic_string<T> logFile;
+
+		//! receives every record when set, otherwise they go to the debugger; wide loggers write multibyte text
+		LogSink *sink;
+	};
+
+	/*!
+		log_stringbuf: put area of STAGING characters inside the object, so
+		streaming a line never allocates. Text past STAGING - 2 characters is
+		dropped until the next flush (std::endl, std::flush) writes the line;
+		a line break still ends the cut line. One thread at a time; use
+		logger.xxx() from worker threads.
+	*/
+	template<Level myLevel>
+	class log_stringbuf : public std::basic_streambuf<T>
+	{
+	public:
+		typedef typename std::basic_streambuf<T>::int_type		int_type;
+		typedef typename std::basic_streambuf<T>::traits_type	traits_type;
+
+		log_stringbuf(const Config &_p) : config(_p), truncated(0)
+		{
+			this->setp(buffer, buffer + STAGING - 2);
+		}
+
+		virtual ~log_stringbuf()
+		{
+			sync();
+		}
+
+		//! Characters dropped because a line outgrew the buffer
+		unsigned int getTruncated() const
+		{
+			return truncated;
+		}
+
+	protected:
+		//! The buffer is full: drop the character, the stream stays good; a line break takes the slot kept for it
+		virtual int_type overflow(int_type c)
+		{
+			if(traits_type::eq_int_type(c, traits_type::to_int_type(T('\n'))) && this->epptr() == buffer + STAGING - 2)
+			{
+				T *end = this->pptr();
+				*end++ = T('\n');
+				this->setp(end, end);
+			}
+			else if(!traits_type::eq_int_type(c, traits_type::eof()))
+			{
+				++truncated;
+			}
+			return traits_type::not_eof(c);
+		}
+
+		virtual int sync()
+		{
+			if(this->pptr() == buffer) return 0;
+
+			*this->pptr() = T();
+			logging<T>::trace( config, myLevel, buffer );
+			this->setp(buffer, buffer + STAGING - 2);
+			return 0;
+		}//sync
+
+		//! Configuration info
+		const Config	&config;
+
+		//! The line being streamed, the last two slots kept for a line break and the terminator
+		T				buffer[STAGING];
+		unsigned int	truncated;
+	};//class log_stringbuf
+
+	//! log_stream
+	template<Level myLevel>
+	class log_stream : public std::basic_ostream<T>
+	{
+	public:
+		enum { COMPILED = (myLevel >= LOGGING_MIN_LEVEL) };
+
+		log_stream(const Config &_p) :
+			std::basic_ostream<T>(&stringbuf),
+			config(_p),
+			stringbuf(_p) {}
+
+		virtual ~log_stream()
+		{
+			//delete rdbuf();
+		}
+
+		//! false when the level is compiled out or below the configured level
+		bool isEnabled() const
+		{
+			return COMPILED && myLevel >= config.cntLevel;
+		}
+
+		//! Enable logger.xxx call; safe from any thread, formats into the calling thread's staging buffer
+		void operator()(const T * fmt, ... )
+		{
+			if(!isEnabled()) return;
+
+			static LOGGING_THREAD_LOCAL T staging[STAGING];
+
+			va_list ap;
+			va_start(ap, fmt);
+			logging<T>::_vsnprintf_s(staging, STAGING, STAGING - 1, fmt, ap);
+			va_end(ap);
+
+			logging<T>::trace( config, myLevel, staging );
+		}
+
+		//! "file(line): count what", the summary LOG_LIMITED and LOG_CHANGED put before a record
+		void skipped(const char *_file, int _line, unsigned int _count, const char *_what)
+		{
+			char text[STAGING];
+#ifdef _MSC_VER
+			_snprintf_s(text, STAGING, _TRUNCATE, "%.512s(%d): %u %.64s\n", _file, _line, _count, _what);
+#else
+			snprintf(text, STAGING, "%.512s(%d): %u %.64s\n", _file, _line, _count, _what);
+#endif
+
+			static LOGGING_THREAD_LOCAL T staging[STAGING];
+			logging<T>::trace( config, myLevel, logging<T>::widen(text, staging, STAGING) );
+		}
+
+	protected:
+		//! Configuration info
+		const Config	&config;
+
+		//! String Buffer
+		log_stringbuf<myLevel>	stringbuf;
+	};//class log_stream
+
+	logging() :
+		debug(config),
+		info(config),
+		warn(config),
+		error(config),
+		fatal(config),
+		writer(0)
+	{
+		config.sink = 0;
+#ifdef _DEBUG
+		setLevel(DEBUG);
+#else
+		setLevel(INFO);
+#endif
+	}
+
+	virtual ~logging()
+	{
+		closeFile();
+	}
+
+	/*!
+		The process-wide logger behind 'logger' and 'loggerw'. Every translation
+		unit binds to it during static initialization, i.e. on the main thread
+		before any other thread can race the construction.
+	*/
+	static logging& instance()
+	{
+		static logging s_instance;
+		return s_instance;
+	}
+
+	//! equal to logger.isEnabledFor
+	bool isEnabledFor(Level _level) const
+	{
+		return _level >= LOGGING_MIN_LEVEL && _level >= config.cntLevel;
+	}
+
+	//! equal to logger.setLevel
+	virtual void setLevel(Level _level)
+	{
+		config.cntLevel = _level;
+	}
+
+	/*!
+		limited implement. Appends to _fname through a background writer, so
+		threads only queue their records, each line prefixed with its time and
+		thread; 0 goes back to the debugger output.
+		Configure before other threads log, the sink is not swapped atomically.
+	*/
+	virtual void startConfig(const T* _fname)
+	{
+		closeFile();
+		if(_fname!=0)
+		{
+			config.logFile = _fname;
+			if(file.open(_fname))
+			{
+				writer = new AsyncLogSink(&file);
+				writer->setOverflow(AsyncLogSink::OVERFLOW_BLOCK);
+				writer->setStamped(true);
+				config.sink = writer;
+			}
+		}
+		else
+		{
+			config.logFile.clear();
+		}
+	}
+
+	//! send records to a sink instead of logFile, e.g. an AsyncLogSink; same threading rule as startConfig
+	virtual void setSink(LogSink *_sink)
+	{
+		config.sink = _sink;
+	}
+
+	//! common output function
+	static void trace(const Config &config, Level myLevel, const T *buf)
+	{
+		if(myLevel<config.cntLevel) return;
+
+		if(config.sink)
+		{
+			logging<T>::publish(config.sink, myLevel, buf);
+		}
+		else
+		{
+			logging<T>::OutputDebugString(buf);
+		}
+	}
+
+	static void OutputDebugString(const T *);
+	static void publish(LogSink *_sink, Level _level, const T *_buf);
+	static const T* widen(const char *_src, T *_DstBuf, size_t _SizeInWords);
+	static void _vsnprintf_s(T * _DstBuf, size_t _SizeInBytes, size_t _MaxCount, const T * _Format, va_list _ArgList);
+
+protected:
+	//! declared before the streams: they keep a reference, and flush into it when they are destroyed
+	Config config;
+
+public:
+	log_stream<DEBUG>		debug;
+	log_stream<INFO>		info;
+	log_stream<WARN>		warn;
+	log_stream<ERROR>		error;
+	log_stream<FATAL>		fatal;
+
+protected:
+	//! drain and close the file opened by startConfig
+	void closeFile()
+	{
+		if(writer)
+		{
+			if(config.sink == writer) config.sink = 0;
+			delete writer;
+			writer = 0;
+		}
+		file.close();
+	}
+
+	//! logFile and the writer thread feeding it
+	FileLogSink		file;
+	AsyncLogSink	*writer;
+
+private:
+	logging(const logging&);
+	logging& operator=(const logging&);
+};//class logging
+
+template <>
+inline void logging<char>::publish(LogSink *_sink, Level _level, const char *_buf)
+{
+	_sink->write(_level, _buf, strlen(_buf));
+}
+
+template <>
+inline void logging<wchar_t>::publish(LogSink *_sink, Level _level, const wchar_t *_buf)
+{
+	static LOGGING_THREAD_LOCAL char bytes[STAGING * 4];
+
+#ifdef _MSC_VER
+	size_t size = 0;
+	if(::wcstombs_s(&size, bytes, sizeof(bytes), _buf, _TRUNCATE) == EILSEQ || size == 0) return;
+	_sink->write(_level, bytes, size - 1);
+#else
+	size_t size = ::wcstombs(bytes, _buf, sizeof(bytes));
+	if(size == (size_t)-1) return;
+	_sink->write(_level, bytes, size);
+#endif
+}
+
+template <>
+inline void logging<char>::OutputDebugString(const char *str)
+{
+#ifdef _WIN32
+	::OutputDebugStringA(str);
+#else
+	StderrLogSink err;
+	publish(&err, NOTSET, str);
+#endif
+}
+
+template <>
+inline void logging<wchar_t>::OutputDebugString(const wchar_t *str)
+{
+#ifdef _WIN32
+	::OutputDebugStringW(str);
+#else
+	StderrLogSink err;
+	publish(&err, NOTSET, str);
+#endif
+}
+
+template <>
+inline const char* logging<char>::widen(const char *_src, char *_DstBuf, size_t _SizeInWords)
+{
+	(void)_DstBuf;
+	(void)_SizeInWords;
+	return _src;
+}
+
+template <>
+inline const wchar_t* logging<wchar_t>::widen(const char *_src, wchar_t *_DstBuf, size_t _SizeInWords)
+{
+#ifdef _MSC_VER
+	size_t size = 0;
+	::mbstowcs_s(&size, _DstBuf, _SizeInWords, _src, _TRUNCATE);
+#else
+	if(::mbstowcs(_DstBuf, _src, _SizeInWords - 1) == (size_t)-1) _DstBuf[0] = 0;
+	_DstBuf[_SizeInWords - 1] = 0;
+#endif
+	return _DstBuf;
+}
+
+template <>
+inline void logging<char>::_vsnprintf_s(char * _DstBuf, size_t _SizeInBytes, size_t _MaxCount, const char * _Format, va_list _ArgList)
+{
+#ifdef _MSC_VER
+	::_vsnprintf_s(_DstBuf,_SizeInBytes,_MaxCount,_Format,_ArgList);
+#else
+	::vsnprintf(_DstBuf,std::min(_SizeInBytes,_MaxCount+1),_Format,_ArgList);
+#endif
+}
+
+template <>
+inline void logging<wchar_t>::_vsnprintf_s(wchar_t * _DstBuf, size_t _SizeInBytes, size_t _MaxCount, const wchar_t * _Format, va_list _ArgList)
+{
+#ifdef _MSC_VER
+	::_vsnwprintf_s(_DstBuf,_SizeInBytes,_MaxCount,_Format,_ArgList);
+#else
+	// vswprintf fails instead of truncating; keep what it wrote
+	size_t size = std::min(_SizeInBytes,_MaxCount+1);
+	if(::vswprintf(_DstBuf,size,_Format,_ArgList) < 0) _DstBuf[size-1] = 0;
+#endif
+}
+
+//! Every translation unit shares the same two loggers and their configuration
+static logging<char>	&logger = logging<char>::instance();
+static logging<wchar_t>	&loggerw = logging<wchar_t>::instance();
@@ -0,0 +1,679 @@
+/*!
+	@brief Log sinks: stderr, persistent file, memory-mapped rolling file and asynchronous background writer
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/thread.h"
+#include "../common/timer.h"
+#include "../common/logstamp.h"
+
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <climits>
+#include <cwchar>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+//! Destination of formatted log records
+class LogSink
+{
+public:
+	virtual ~LogSink() {}
+
+	//! One record of 'size' bytes, not null terminated; may be called from any thread
+	virtual void	write(int level, const char *text, size_t size) = 0;
+
+	//! Push buffered records to their destination
+	virtual void	flush() {}
+};
+
+//! Standard error, unbuffered; every write() is one system call
+class StderrLogSink : public LogSink
+{
+public:
+	virtual void	write(int level, const char *text, size_t size)
+	{
+		(void)level;
+		while(size > 0)
+		{
+#ifdef _WIN32
+			DWORD written = 0;
+			if(!::WriteFile(::GetStdHandle(STD_ERROR_HANDLE), text, (DWORD)size, &written, NULL) || written == 0) return;
+#else
+			ssize_t written = ::write(STDERR_FILENO, text, size);
+			if(written < 0 && errno == EINTR) continue;
+			if(written <= 0) return;
+#endif
+			text += written;
+			size -= (size_t)written;
+		}
+	}
+};
+
+//! Log file kept open for the lifetime of the sink; every write() is one system call
+class FileLogSink : public LogSink
+{
+public:
+	FileLogSink()
+	{
+#ifdef _WIN32
+		m_file = INVALID_HANDLE_VALUE;
+#else
+		m_file = -1;
+#endif
+	}
+
+	virtual ~FileLogSink()
+	{
+		close();
+	}
+
+	//! Appends to an existing file unless 'truncate' is set
+	bool open(const char *fileName, bool truncate = false)
+	{
+		close();
+#ifdef _WIN32
+		m_file = ::CreateFileA(fileName, FILE_APPEND_DATA, FILE_SHARE_READ, NULL,
+			truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+		m_file = ::open(fileName, O_WRONLY | O_CREAT | O_APPEND | (truncate ? O_TRUNC : 0), 0644);
+#endif
+		return isOpen();
+	}
+
+	bool open(const wchar_t *fileName, bool truncate = false)
+	{
+#ifdef _WIN32
+		close();
+		m_file = ::CreateFileW(fileName, FILE_APPEND_DATA, FILE_SHARE_READ, NULL,
+			truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+		return isOpen();
+#else
+		std::vector<char> name(wcslen(fileName) * MB_LEN_MAX + 1);
+		if(wcstombs(&name[0], fileName, name.size()) == (size_t)-1) return false;
+		return open(&name[0], truncate);
+#endif
+	}
+
+	void close()
+	{
+		if(!isOpen()) return;
+#ifdef _WIN32
+		::CloseHandle(m_file);
+		m_file = INVALID_HANDLE_VALUE;
+#else
+		::close(m_file);
+		m_file = -1;
+#endif
+	}
+
+	bool isOpen() const
+	{
+#ifdef _WIN32
+		return m_file != INVALID_HANDLE_VALUE;
+#else
+		return m_file >= 0;
+#endif
+	}
+
+	virtual void	write(int level, const char *text, size_t size)
+	{
+		(void)level;
+		if(!isOpen()) return;
+
+		while(size > 0)
+		{
+#ifdef _WIN32
+			DWORD written = 0;
+			if(!::WriteFile(m_file, text, (DWORD)size, &written, NULL) || written == 0) return;
+#else
+			ssize_t written = ::write(m_file, text, size);
+			if(written < 0 && errno == EINTR) continue;
+			if(written <= 0) return;
+#endif
+			text += written;
+			size -= (size_t)written;
+		}
+	}
+
+protected:
+#ifdef _WIN32
+	HANDLE	m_file;
+#else
+	int		m_file;
+#endif
+
+	FileLogSink(const FileLogSink&);
+	FileLogSink& operator=(const FileLogSink&);
+};
+
+/*!
+	Rolling log file written through a memory mapping. The file is grown to
+	its full size up front and mapped once, so a write() is a memcpy and
+	costs no system call until the file is full; then it is cut to the bytes
+	written, renamed to name.1 (older ones to name.2 ... name.<backups>) and
+	a fresh file is mapped. A crashed process leaves the unwritten tail of
+	the current file zero filled.
+*/
+class MappedLogSink : public LogSink
+{
+public:
+	MappedLogSink() :
+		m_capacity(0),
+		m_backups(0),
+		m_view(0),
+		m_used(0),
+		m_lock(0),
+		m_rotations(0)
+	{
+#ifdef _WIN32
+		m_file = INVALID_HANDLE_VALUE;
+		m_mapping = NULL;
+#else
+		m_file = -1;
+#endif
+	}
+
+	virtual ~MappedLogSink()
+	{
+		close();
+	}
+
+	//! Appends to fileName, rotating whenever it reaches fileSize bytes
+	bool open(const char *fileName, size_t fileSize = 4 * 1024 * 1024, int backups = 3)
+	{
+		close();
+		m_name = fileName;
+		m_capacity = std::max(fileSize, (size_t)4096);
+		m_backups = std::max(backups, 0);
+		return map(false);
+	}
+
+	void close()
+	{
+		lock();
+		unmap();
+		unlock();
+	}
+
+	bool isOpen() const
+	{
+		return m_view != 0;
+	}
+
+	//! Any thread; a record that does not fit into the rest of the file starts the next one
+	virtual void	write(int level, const char *text, size_t size)
+	{
+		(void)level;
+		lock();
+		if(m_view && m_used > 0 && m_used + size > m_capacity)
+		{
+			rotate();
+		}
+		while(m_view && size > 0)
+		{
+			if(m_used == m_capacity && !rotate()) break;
+
+			size_t chunk = std::min(size, m_capacity - m_used);
+			memcpy(m_view + m_used, text, chunk);
+			m_used += chunk;
+			text += chunk;
+			size -= chunk;
+		}
+		unlock();
+	}
+
+	//! Schedule the written pages for the disk; other processes see them without it
+	virtual void	flush()
+	{
+		lock();
+		if(m_view)
+		{
+#ifdef _WIN32
+			::FlushViewOfFile(m_view, m_used);
+#else
+			::msync(m_view, m_capacity, MS_ASYNC);
+#endif
+		}
+		unlock();
+	}
+
+	//! Files completed so far
+	int rotations() const
+	{
+		return m_rotations;
+	}
+
+protected:
+	void lock()
+	{
+		while(!m_lock.compareExchange(0, 1))
+		{
+			Thread::yield();
+		}
+	}
+
+	void unlock()
+	{
+		m_lock.store(0);
+	}
+
+	//! Open m_name, keep its contents unless 'truncate' and map it at m_capacity bytes
+	bool map(bool truncate)
+	{
+#ifdef _WIN32
+		m_file = ::CreateFileA(m_name.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL,
+			truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+		if(m_file == INVALID_HANDLE_VALUE) return false;
+
+		LARGE_INTEGER size;
+		if(!::GetFileSizeEx(m_file, &size)) size.QuadPart = 0;
+		m_used = (size_t)size.QuadPart;
+		if(m_used >= m_capacity) return rotate();
+
+		m_mapping = ::CreateFileMappingA(m_file, NULL, PAGE_READWRITE, 0, (DWORD)m_capacity, NULL);
+		if(m_mapping) m_view = (char*)::MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, m_capacity);
+#else
+		m_file = ::open(m_name.c_str(), O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0), 0644);
+		if(m_file < 0) return false;
+
+		struct stat info;
+		m_used = (::fstat(m_file, &info) == 0) ? (size_t)info.st_size : 0;
+		if(m_used >= m_capacity) return rotate();
+
+		if(::ftruncate(m_file, (off_t)m_capacity) == 0)
+		{
+			void *view = ::mmap(NULL, m_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+			if(view != MAP_FAILED) m_view = (char*)view;
+		}
+#endif
+		if(!m_view) unmap();
+		return m_view != 0;
+	}
+
+	//! Release the mapping and cut the file to what was written
+	void unmap()
+	{
+#ifdef _WIN32
+		if(m_view) ::UnmapViewOfFile(m_view);
+		if(m_mapping) ::CloseHandle(m_mapping);
+		m_view = 0;
+		m_mapping = NULL;
+		if(m_file == INVALID_HANDLE_VALUE) return;
+
+		LARGE_INTEGER end;
+		end.QuadPart = (LONGLONG)m_used;
+		if(::SetFilePointerEx(m_file, end, NULL, FILE_BEGIN)) ::SetEndOfFile(m_file);
+		::CloseHandle(m_file);
+		m_file = INVALID_HANDLE_VALUE;
+#else
+		if(m_view) ::munmap(m_view, m_capacity);
+		m_view = 0;
+		if(m_file < 0) return;
+
+		int cut = ::ftruncate(m_file, (off_t)m_used);
+		(void)cut;
+		::close(m_file);
+		m_file = -1;
+#endif
+	}
+
+	//! Close the current file, shift the backups and map an empty one
+	bool rotate()
+	{
+		unmap();
+		++m_rotations;
+
+		for(int i=m_backups; i>1; --i)
+		{
+			moveFile(backupName(i - 1), backupName(i));
+		}
+		bool moved = (m_backups == 0) ? remove(m_name.c_str()) == 0 : moveFile(m_name, backupName(1));
+
+		// a file that stays in place (open elsewhere, no permission) is started over instead of rotated again
+		return map(!moved);
+	}
+
+	static bool moveFile(const std::string &from, const std::string &to)
+	{
+#ifdef _WIN32
+		return ::MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+		return ::rename(from.c_str(), to.c_str()) == 0;
+#endif
+	}
+
+	std::string backupName(int index) const
+	{
+		char suffix[16];
+#ifdef _MSC_VER
+		_snprintf_s(suffix, sizeof(suffix), _TRUNCATE, ".%d", index);
+#else
+		snprintf(suffix, sizeof(suffix), ".%d", index);
+#endif
+		return m_name + suffix;
+	}
+
+	std::string	m_name;
+	size_t		m_capacity;
+	int			m_backups;
+
+#ifdef _WIN32
+	HANDLE	m_file;
+	HANDLE	m_mapping;
+#else
+	int		m_file;
+#endif
+	char*	m_view;
+	size_t	m_used;
+
+	//! guards the mapping, uncontended behind an AsyncLogSink
+	AtomicInt	m_lock;
+	int			m_rotations;
+
+	MappedLogSink(const MappedLogSink&);
+	MappedLogSink& operator=(const MappedLogSink&);
+};
+
+/*!
+	Moves record output off the calling thread. Producers copy a record into a
+	bounded lock-free ring (any number of threads); a background thread drains
+	it and hands the target sink large batches instead of one write per record.
+	Records longer than MAX_RECORD bytes are truncated. With setStamped() each
+	record carries a LogStamp, turned into a time and thread prefix by the writer.
+*/
+class AsyncLogSink : public LogSink, protected Thread
+{
+public:
+	enum
+	{
+		MAX_RECORD = 500,
+	};
+
+	//! What a producer does when the ring is full
+	enum Overflow
+	{
+		OVERFLOW_DROP = 0,	//!< discard the record and count it
+		OVERFLOW_BLOCK,		//!< wait for the writer to make room
+	};
+
+	//! 'capacity' records, rounded up to a power of two; the target is written from the background thread only
+	explicit AsyncLogSink(LogSink *target, int capacity = 1024) :
+		m_target(target),
+		m_head(0),
+		m_overflow(OVERFLOW_DROP),
+		m_batchBytes(64 * 1024),
+		m_interval(100),
+		m_flushLevel(40),
+		m_stamped(false),
+		m_quit(0),
+		m_flushRequested(0),
+		m_flushed(0),
+		m_dropped(0),
+		m_truncated(0),
+		m_batches(0)
+	{
+		m_capacity = 2;
+		while(m_capacity < capacity) m_capacity <<= 1;
+
+		m_cells = new Cell[m_capacity];
+		for(int i=0; i<m_capacity; ++i)
+		{
+			m_cells[i].sequence.store(i);
+		}
+		m_batch.reserve(m_batchBytes + MAX_RECORD + LogClock::TEXT_SIZE);
+
+		start();
+	}
+
+	virtual ~AsyncLogSink()
+	{
+		m_quit.store(1);
+		m_wake.signal();
+		join();
+		delete [] m_cells;
+	}
+
+	void setOverflow(Overflow overflow)
+	{
+		m_overflow = overflow;
+	}
+
+	//! Prefix records with "hh:mm:ss.uuuuuu [thread] "; set before records arrive
+	void setStamped(bool stamped)
+	{
+		m_stamped = stamped;
+	}
+
+	/*!
+		Flush policy. The writer wakes up every 'intervalMs', when 'batchBytes'
+		have piled up, or right after a record at 'flushLevel' or above, and
+		hands the target everything queued so far.
+	*/
+	void setFlushPolicy(size_t batchBytes, unsigned int intervalMs, int flushLevel)
+	{
+		m_batchBytes = std::max(batchBytes, (size_t)MAX_RECORD);
+		m_interval = std::max(intervalMs, 1u);
+		m_flushLevel = flushLevel;
+	}
+
+	//! Any thread: queue one record, never calls into the target
+	virtual void	write(int level, const char *text, size_t size)
+	{
+		if(size > MAX_RECORD)
+		{
+			size = MAX_RECORD;
+			m_truncated.fetchAdd(1);
+		}
+
+		Cell *cell = acquire();
+		while(!cell)
+		{
+			if(m_overflow == OVERFLOW_DROP)
+			{
+				m_dropped.fetchAdd(1);
+				return;
+			}
+			m_wake.signal();
+			Thread::yield();
+			cell = acquire();
+		}
+
+		if(m_stamped) cell->stamp = LogStamp::now();
+		cell->level = level;
+		cell->size = (int)size;
+		memcpy(cell->text, text, size);
+		publish(cell);
+
+		// the writer also wakes on its own every interval
+		if(level >= m_flushLevel || pending() >= m_capacity / 2)
+		{
+			m_wake.signal();
+		}
+	}
+
+	//! Any thread: returns once everything queued before the call has reached the target
+	virtual void	flush()
+	{
+		int requested = m_flushRequested.fetchAdd(1) + 1;
+		while(m_flushed.load() - requested < 0)
+		{
+			m_wake.signal();
+			Thread::yield();
+		}
+	}
+
+	//! Records lost to a full ring with OVERFLOW_DROP
+	int dropped() const
+	{
+		return m_dropped.load();
+	}
+
+	//! Records cut at MAX_RECORD bytes
+	int truncated() const
+	{
+		return m_truncated.load();
+	}
+
+	//! Writes handed to the target
+	int batches() const
+	{
+		return m_batches.load();
+	}
+
+protected:
+	struct Cell
+	{
+		AtomicInt	sequence;
+		int			level;
+		int			size;
+		LogStamp	stamp;
+		char		text[MAX_RECORD];
+	};
+
+	//! Producer: claim the cell at the tail, 0 when the ring is full
+	Cell* acquire()
+	{
+		int pos = m_tail.loadRelaxed();
+		for(;;)
+		{
+			Cell *cell = &m_cells[pos & (m_capacity - 1)];
+			int diff = cell->sequence.load() - pos;
+			if(diff == 0)
+			{
+				if(m_tail.compareExchange(pos, pos + 1)) return cell;
+				pos = m_tail.loadRelaxed();
+			}
+			else if(diff < 0)
+			{
+				return 0;
+			}
+			else
+			{
+				pos = m_tail.loadRelaxed();
+			}
+		}
+	}
+
+	//! Producer: hand a filled cell to the writer
+	void publish(Cell *cell)
+	{
+		int pos = cell->sequence.loadRelaxed();
+		cell->sequence.store(pos + 1);
+	}
+
+	//! Approximate number of queued records
+	int pending() const
+	{
+		return m_tail.load() - m_head.load();
+	}
+
+	virtual void run()
+	{
+		for(;;)
+		{
+			bool quit = m_quit.load() != 0;
+			int flushRequested = m_flushRequested.load();
+
+			if(m_stamped) m_clock.calibrate();
+			drain();
+			if(!m_batch.empty())
+			{
+				writeBatch();
+			}
+			if(m_flushed.load() != flushRequested)
+			{
+				m_target->flush();
+				m_flushed.store(flushRequested);
+			}
+
+			if(quit) break;
+			m_wake.wait(m_interval);
+		}
+		m_target->flush();
+	}
+
+	//! Writer: move every published record into the batch, writing whenever it fills up
+	void drain()
+	{
+		int head = m_head.loadRelaxed();
+		for(;;)
+		{
+			Cell *cell = &m_cells[head & (m_capacity - 1)];
+			if(cell->sequence.load() != head + 1) return;
+
+			if(m_stamped)
+			{
+				char prefix[LogClock::TEXT_SIZE];
+				int length = m_clock.format(cell->stamp.ticks, cell->stamp.thread, prefix);
+				m_batch.insert(m_batch.end(), prefix, prefix + length);
+			}
+			m_batch.insert(m_batch.end(), cell->text, cell->text + cell->size);
+			int level = cell->level;
+
+			cell->sequence.store(head + m_capacity);
+			m_head.store(++head);
+
+			if(m_batch.size() >= m_batchBytes || level >= m_flushLevel)
+			{
+				writeBatch();
+			}
+		}
+	}
+
+	void writeBatch()
+	{
+		m_target->write(0, &m_batch[0], m_batch.size());
+		m_batch.clear();
+		m_batches.fetchAdd(1);
+	}
+
+	LogSink*	m_target;
+
+	Cell*		m_cells;
+	int			m_capacity;
+
+	//! next cell to claim, shared by the producers
+	AtomicInt	m_tail;
+
+	//! keeps the producers' index off the writer's cache line
+	char		m_padding[64];
+
+	//! next cell to drain, written by the writer only
+	AtomicInt	m_head;
+
+	std::vector<char>	m_batch;
+
+	Overflow		m_overflow;
+	size_t			m_batchBytes;
+	unsigned int	m_interval;
+	int				m_flushLevel;
+	bool			m_stamped;
+
+	//! writer only
+	LogClock		m_clock;
+
+	Event		m_wake;
+	AtomicInt	m_quit;
+	AtomicInt	m_flushRequested;
+	AtomicInt	m_flushed;
+
+	AtomicInt	m_dropped;
+	AtomicInt	m_truncated;
+	AtomicInt	m_batches;
+
+	AsyncLogSink(const AsyncLogSink&);
+	AsyncLogSink& operator=(const AsyncLogSink&);
+};
@@ -0,0 +1,224 @@
+/*!
+	@brief Cheap log record timestamps and thread ids, formatted at sink time
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/timer.h"
+
+#include <cstdio>
+#include <ctime>
+#include <cmath>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+//! Per-thread storage for POD data
+#ifdef _MSC_VER
+#define LOGGING_THREAD_LOCAL __declspec(thread)
+#else
+#define LOGGING_THREAD_LOCAL __thread
+#endif
+
+/*!
+	What a producer records with a log line: a raw counter read and a small
+	thread number. Turning them into text is left to the sink's writer.
+*/
+struct LogStamp
+{
+	long long		ticks;
+	unsigned int	thread;
+
+	static LogStamp now()
+	{
+		LogStamp stamp;
+		stamp.ticks = readTicks();
+		stamp.thread = threadId();
+		return stamp;
+	}
+
+	//! The time stamp counter on x86, else the coarse or regular monotonic clock; LogClock converts it
+	static long long readTicks()
+	{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+		return (long long)__rdtsc();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+		return (long long)__builtin_ia32_rdtsc();
+#elif defined(CLOCK_MONOTONIC_COARSE)
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+		return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#else
+		return HighResolutionTimer::ticks();
+#endif
+	}
+
+	//! 1, 2, 3... in the order threads first ask; cached, so later calls are one thread-local read
+	static unsigned int threadId()
+	{
+		static LOGGING_THREAD_LOCAL unsigned int t_id;
+		if(t_id == 0)
+		{
+			static AtomicInt s_next;
+			t_id = (unsigned int)s_next.fetchAdd(1) + 1;
+		}
+		return t_id;
+	}
+};
+
+//! What LogClock needs to turn ticks into wall time; saved with binary logs so they can be read elsewhere
+struct LogCalibration
+{
+	long long	baseTicks;		//!< LogStamp::readTicks() at baseSecond + baseFraction
+	long long	baseSecond;		//!< seconds since 1970
+	double		baseFraction;
+	double		frequency;		//!< ticks per second
+};
+
+/*!
+	Converts LogStamp ticks to local time of day. Creating a clock only takes
+	the base readings; the tick rate is measured against HighResolutionTimer
+	by the first calibrate() or format() and refined by every calibrate(), so
+	a writer calling it once per batch keeps the error shrinking as the
+	baseline grows. Assumes an invariant TSC, which every x86 CPU of the
+	last decade has. One thread at a time.
+*/
+class LogClock
+{
+public:
+	enum
+	{
+		//! Bytes format() writes at most, including the terminator
+		TEXT_SIZE = 48,
+	};
+
+	LogClock() :
+		m_frequency(0.0),
+		m_cachedSecond(-1)
+	{
+		m_cachedText[0] = 0;
+
+		m_baseCounter = HighResolutionTimer::ticks();
+		m_baseTicks = LogStamp::readTicks();
+		wallClock(m_baseSecond, m_baseFraction);
+	}
+
+	//! Measure the tick rate over everything since construction, at least one millisecond
+	void calibrate()
+	{
+		long long counter;
+		long long ticks;
+		for(;;)
+		{
+			counter = HighResolutionTimer::ticks();
+			ticks = LogStamp::readTicks();
+
+			// the first estimate waits for a millisecond and a tick that moved; a clock
+			// that was created well before its first use does not wait at all
+			if(m_frequency != 0.0) break;
+			if(counter - m_baseCounter >= HighResolutionTimer::frequency() / 1000 && ticks != m_baseTicks) break;
+		}
+
+		double elapsed = (double)(counter - m_baseCounter) / (double)HighResolutionTimer::frequency();
+		if(elapsed > 0.0 && ticks != m_baseTicks)
+		{
+			m_frequency = (double)(ticks - m_baseTicks) / elapsed;
+		}
+	}
+
+	//! Ticks per second, 0 before the first calibrate()
+	double getFrequency() const
+	{
+		return m_frequency;
+	}
+
+	LogCalibration getCalibration() const
+	{
+		LogCalibration calibration;
+		calibration.baseTicks = m_baseTicks;
+		calibration.baseSecond = m_baseSecond;
+		calibration.baseFraction = m_baseFraction;
+		calibration.frequency = m_frequency;
+		return calibration;
+	}
+
+	//! Convert with another clock's calibration, e.g. a saved one; do not calibrate() afterwards
+	void setCalibration(const LogCalibration &calibration)
+	{
+		m_baseTicks = calibration.baseTicks;
+		m_baseSecond = calibration.baseSecond;
+		m_baseFraction = calibration.baseFraction;
+		m_frequency = calibration.frequency;
+		m_cachedSecond = -1;
+	}
+
+	//! Seconds from the clock's creation to 'ticks'; calibrate() first
+	double elapsed(long long ticks) const
+	{
+		return (double)(ticks - m_baseTicks) / m_frequency;
+	}
+
+	//! "hh:mm:ss.uuuuuu [thread] " into 'text', returns its length
+	int format(long long ticks, unsigned int thread, char *text)
+	{
+		if(m_frequency == 0.0) calibrate();
+
+		double t = m_baseFraction + (double)(ticks - m_baseTicks) / m_frequency;
+		double whole = floor(t);
+		long long second = m_baseSecond + (long long)whole;
+		int micro = (int)((t - whole) * 1000000.0);
+		if(micro > 999999) micro = 999999;
+
+		if(second != m_cachedSecond)
+		{
+			m_cachedSecond = second;
+
+			time_t value = (time_t)second;
+			tm local;
+#ifdef _WIN32
+			localtime_s(&local, &value);
+#else
+			localtime_r(&value, &local);
+#endif
+			strftime(m_cachedText, sizeof(m_cachedText), "%H:%M:%S", &local);
+		}
+
+#ifdef _MSC_VER
+		return _snprintf_s(text, TEXT_SIZE, _TRUNCATE, "%s.%06d [%u] ", m_cachedText, micro, thread);
+#else
+		return snprintf(text, TEXT_SIZE, "%s.%06d [%u] ", m_cachedText, micro, thread);
+#endif
+	}
+
+protected:
+	//! Seconds since 1970 split into whole and fraction
+	static void wallClock(long long &second, double &fraction)
+	{
+#ifdef _WIN32
+		FILETIME ft;
+		::GetSystemTimeAsFileTime(&ft);
+		long long hundreds = ((long long)ft.dwHighDateTime << 32 | ft.dwLowDateTime) - 116444736000000000LL;
+		second = hundreds / 10000000LL;
+		fraction = (double)(hundreds % 10000000LL) / 10000000.0;
+#else
+		timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		second = ts.tv_sec;
+		fraction = (double)ts.tv_nsec / 1000000000.0;
+#endif
+	}
+
+	long long	m_baseCounter;
+	long long	m_baseTicks;
+	long long	m_baseSecond;
+	double		m_baseFraction;
+	double		m_frequency;
+
+	//! "hh:mm:ss" of m_cachedSecond, localtime is not called per record
+	long long	m_cachedSecond;
+	char		m_cachedText[16];
+};
@@ -0,0 +1,210 @@
+/*!
+	@brief Stereo / multi-view output from one Camera update
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/camera.h"
+
+//! Per-eye view and off-axis projection matrices derived from a single Camera
+ATTRIBUTE_ALIGNED16_CLASS(class MultiViewCamera)
+{
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR()
+
+	enum
+	{
+		MAX_VIEWS = 8,
+	};
+
+	//! Culling planes of the combined frustum, normals point inwards
+	enum Plane
+	{
+		PLANE_LEFT = 0,
+		PLANE_RIGHT,
+		PLANE_BOTTOM,
+		PLANE_TOP,
+		PLANE_NEAR,
+		PLANE_FAR,
+		PLANE_COUNT,
+	};
+
+	MultiViewCamera() : m_viewCount(1), m_convergence(10.0f)
+	{
+		for(int i=0; i<MAX_VIEWS; ++i)
+		{
+			m_offsets[i][0] = m_offsets[i][1] = m_offsets[i][2] = 0.0f;
+		}
+	}
+
+	//! Two eyes 'ipd' apart with zero parallax at 'convergence' world units
+	void setStereo(float ipd, float convergence)
+	{
+		float offsets[2][3] =
+		{
+			{ -0.5f * ipd, 0.0f, 0.0f },
+			{  0.5f * ipd, 0.0f, 0.0f },
+		};
+		setEyeOffsets(offsets, 2, convergence);
+	}
+
+	//! Eye positions in view space (x right, y up, z forward)
+	void setEyeOffsets(const float (*offsets)[3], int count, float convergence)
+	{
+		m_viewCount = std::min(std::max(count, 1), (int)MAX_VIEWS);
+		m_convergence = std::max(convergence, SIMD_EPSILON);
+		for(int i=0; i<m_viewCount; ++i)
+		{
+			m_offsets[i][0] = offsets[i][0];
+			m_offsets[i][1] = offsets[i][1];
+			m_offsets[i][2] = offsets[i][2];
+		}
+	}
+
+	int getViewCount() const
+	{
+		return m_viewCount;
+	}
+
+	//! Build every eye from the camera's current view and projection
+	void update(const Camera &camera)
+	{
+		const vmMatrix4 &view = camera.getViewMatrix();
+		const vmMatrix4 &proj = camera.getProjMatrix();
+
+		float xScale = proj[0][0];
+		float yScale = proj[1][1];
+
+		for(int i=0; i<m_viewCount; ++i)
+		{
+			const float *o = m_offsets[i];
+
+			// same rotation, eye moved along the shared view axes
+			m_viewMatrices[i] = view;
+			m_viewMatrices[i].setTranslation(view.getTranslation() - vmVector3(o[0], o[1], o[2]));
+
+			// shear so the convergence plane has zero parallax
+			m_projMatrices[i] = proj;
+			m_projMatrices[i][2][0] = xScale * o[0] / m_convergence;
+			m_projMatrices[i][2][1] = yScale * o[1] / m_convergence;
+
+			m_viewProjMatrices[i] = m_projMatrices[i] * m_viewMatrices[i];
+		}
+
+		updateCullingFrustum();
+	}
+
+	const vmMatrix4& getViewMatrix(int n) const
+	{
+		return m_viewMatrices[n];
+	}
+
+	const vmMatrix4& getProjMatrix(int n) const
+	{
+		return m_projMatrices[n];
+	}
+
+	const vmMatrix4& getViewProjMatrix(int n) const
+	{
+		return m_viewProjMatrices[n];
+	}
+
+	//! World-space plane (normal, d); a point p is inside when dot(normal, p) + d >= 0 for all planes
+	const vmVector4& getCullingPlane(int plane) const
+	{
+		return m_cullingPlanes[plane];
+	}
+
+	//! Sphere test against the frustum enclosing all eyes
+	bool isSphereVisible(const vmVector3 &center, float radius) const
+	{
+		for(int n=0; n<PLANE_COUNT; ++n)
+		{
+			const vmVector4 &plane = m_cullingPlanes[n];
+			if(dot(plane.getXYZ(), center) + plane.getW() < -radius) return false;
+		}
+		return true;
+	}
+
+protected:
+	//! Average the eyes' plane normals, then push each plane out past every eye's corners
+	void updateCullingFrustum()
+	{
+		vmVector3 normals[PLANE_COUNT];
+		for(int n=0; n<PLANE_COUNT; ++n)
+		{
+			normals[n] = vmVector3(0.0f);
+		}
+
+		for(int i=0; i<m_viewCount; ++i)
+		{
+			vmVector4 planes[PLANE_COUNT];
+			extractPlanes(m_viewProjMatrices[i], planes);
+			for(int n=0; n<PLANE_COUNT; ++n)
+			{
+				normals[n] += planes[n].getXYZ();
+			}
+		}
+
+		for(int n=0; n<PLANE_COUNT; ++n)
+		{
+			normals[n] = normalize(normals[n]);
+			m_cullingPlanes[n] = vmVector4(normals[n], -SIMD_INFINITY);
+		}
+
+		for(int i=0; i<m_viewCount; ++i)
+		{
+			vmMatrix4 invViewProj = inverse(m_viewProjMatrices[i]);
+
+			for(int c=0; c<8; ++c)
+			{
+				vmVector4 clip((c & 1) ? 1.0f : -1.0f, (c & 2) ? 1.0f : -1.0f, (c & 4) ? 1.0f : 0.0f, 1.0f);
+				vmVector4 world = invViewProj * clip;
+				vmVector3 corner = world.getXYZ() / world.getW();
+
+				for(int n=0; n<PLANE_COUNT; ++n)
+				{
+					float d = -dot(normals[n], corner);
+					if(d > m_cullingPlanes[n].getW())
+					{
+						m_cullingPlanes[n].setW(d);
+					}
+				}
+			}
+		}
+	}
+
+	//! Gribb-Hartmann plane extraction for a D3D style (z in [0,1]) clip matrix
+	static void extractPlanes(const vmMatrix4 &m, vmVector4 *planes)
+	{
+		vmVector4 r0 = m.getRow(0);
+		vmVector4 r1 = m.getRow(1);
+		vmVector4 r2 = m.getRow(2);
+		vmVector4 r3 = m.getRow(3);
+
+		planes[PLANE_LEFT] = r3 + r0;
+		planes[PLANE_RIGHT] = r3 - r0;
+		planes[PLANE_BOTTOM] = r3 + r1;
+		planes[PLANE_TOP] = r3 - r1;
+		planes[PLANE_NEAR] = r2;
+		planes[PLANE_FAR] = r3 - r2;
+
+		for(int n=0; n<PLANE_COUNT; ++n)
+		{
+			planes[n] /= length(planes[n].getXYZ());
+		}
+	}
+
+	vmMatrix4	m_viewMatrices[MAX_VIEWS];
+	vmMatrix4	m_projMatrices[MAX_VIEWS];
+	vmMatrix4	m_viewProjMatrices[MAX_VIEWS];
+	vmVector4	m_cullingPlanes[PLANE_COUNT];
+
+	//! eye offsets in view space
+	float	m_offsets[MAX_VIEWS][3];
+
+	int		m_viewCount;
+	float	m_convergence;
+};
@@ -0,0 +1,330 @@
+/*!
+	@brief Scoped CPU profiler zones, frame markers and counters with Chrome trace export
+	@author Shintaro Takemura
+
+	Define USE_PROFILER to compile it in; otherwise the PROFILE_xxx macros
+	expand to nothing. Open the exported file in chrome://tracing or
+	ui.perfetto.dev.
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/thread.h"
+#include "../common/logstamp.h"
+
+#include <cstdio>
+
+#ifdef USE_PROFILER
+
+#define PROFILE_CONCAT_(a, b)	a##b
+#define PROFILE_CONCAT(a, b)	PROFILE_CONCAT_(a, b)
+
+//! Times the rest of the enclosing scope; 'name' has to be a string literal
+#define PROFILE_ZONE(name)	ProfileZone PROFILE_CONCAT(_profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION()	PROFILE_ZONE(__FUNCTION__)
+//! Vertical marker across all threads, e.g. at the start of every frame
+#define PROFILE_FRAME(name)	Profiler::mark(Profiler::EVENT_FRAME, (name), 0.0)
+//! Sampled value drawn as a graph
+#define PROFILE_COUNTER(name, value)	Profiler::mark(Profiler::EVENT_COUNTER, (name), (double)(value))
+//! Label for the calling thread's track
+#define PROFILE_THREAD(name)	Profiler::setThreadName(name)
+#define PROFILE_EXPORT(fileName)	Profiler::instance().writeChromeTrace(fileName)
+
+#else
+
+#define PROFILE_ZONE(name)
+#define PROFILE_FUNCTION()
+#define PROFILE_FRAME(name)
+#define PROFILE_COUNTER(name, value)	((void)sizeof(value))
+#define PROFILE_THREAD(name)
+#define PROFILE_EXPORT(fileName)
+
+#endif
+
+//! One record in a thread's ring
+struct ProfileEvent
+{
+	long long		ticks;	//!< LogStamp::readTicks()
+	const char*		name;
+	double			value;	//!< EVENT_COUNTER only
+	int				type;
+};
+
+//! Last CAPACITY events of one thread; written by that thread only, older events are overwritten
+class ProfileBuffer
+{
+public:
+	enum
+	{
+		CAPACITY = 1 << 14,
+	};
+
+	ProfileBuffer() :
+		m_thread(LogStamp::threadId()),
+		m_name(0),
+		m_count(0)
+	{
+	}
+
+	//! Owner thread
+	void push(int type, const char *name, double value)
+	{
+		int count = m_count.loadRelaxed();
+		ProfileEvent &event = m_events[count & (CAPACITY - 1)];
+		event.ticks = LogStamp::readTicks();
+		event.name = name;
+		event.value = value;
+		event.type = type;
+		m_count.store(count + 1);
+	}
+
+	/*!
+		Any thread: the events still in the ring, oldest first. Events the
+		owner overwrote during the copy, or may be overwriting right now, are
+		left out.
+	*/
+	void copy(std::vector<ProfileEvent> &events) const
+	{
+		int end = m_count.load();
+		int begin = std::max(end - (int)CAPACITY, 0);
+
+		events.clear();
+		for(int n=begin; n<end; ++n)
+		{
+			events.push_back(m_events[n & (CAPACITY - 1)]);
+		}
+
+		// the owner's next push goes to the slot of event 'count - CAPACITY' before it bumps the count
+		atomicAcquireFence();
+		int overwritten = m_count.load() + 1 - (int)CAPACITY - begin;
+		if(overwritten > 0)
+		{
+			events.erase(events.begin(), events.begin() + std::min((size_t)overwritten, events.size()));
+		}
+	}
+
+	unsigned int	m_thread;
+	const char*		m_name;
+
+protected:
+	ProfileEvent	m_events[CAPACITY];
+	AtomicInt		m_count;
+
+	ProfileBuffer(const ProfileBuffer&);
+	ProfileBuffer& operator=(const ProfileBuffer&);
+};
+
+/*!
+	Process-wide collector. Recording an event is a thread-local lookup, a
+	counter read and four stores into the thread's own ring; no locks and no
+	allocations after the thread's first event. Exporting copies the rings
+	while the threads keep running.
+*/
+class Profiler
+{
+public:
+	enum EventType
+	{
+		EVENT_BEGIN = 0,
+		EVENT_END,
+		EVENT_FRAME,
+		EVENT_COUNTER,
+	};
+
+	static Profiler& instance()
+	{
+		static Profiler s_profiler;
+		return s_profiler;
+	}
+
+	~Profiler()
+	{
+		for(size_t n=0; n<m_buffers.size(); ++n)
+		{
+			delete m_buffers[n];
+		}
+	}
+
+	//! The calling thread's ring, created and registered on its first event
+	static ProfileBuffer* threadBuffer()
+	{
+		static LOGGING_THREAD_LOCAL ProfileBuffer *t_buffer;
+		if(!t_buffer)
+		{
+			t_buffer = instance().attach();
+		}
+		return t_buffer;
+	}
+
+	static void mark(int type, const char *name, double value)
+	{
+		threadBuffer()->push(type, name, value);
+	}
+
+	static void setThreadName(const char *name)
+	{
+		threadBuffer()->m_name = name;
+	}
+
+	//! Zones as complete events, frames as global instants, counters as graphs; false if the file cannot be written
+	bool writeChromeTrace(const char *fileName)
+	{
+		FILE *fp = NULL;
+#ifdef _MSC_VER
+		if(fopen_s(&fp, fileName, "w") != 0) return false;
+#else
+		fp = fopen(fileName, "w");
+		if(!fp) return false;
+#endif
+
+		lock();
+		std::vector<ProfileBuffer*> buffers = m_buffers;
+		unlock();
+
+		m_clock.calibrate();
+
+		fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+		bool first = true;
+
+		std::vector<ProfileEvent> events;
+		std::vector<const ProfileEvent*> open;
+		for(size_t b=0; b<buffers.size(); ++b)
+		{
+			unsigned int tid = buffers[b]->m_thread;
+			if(buffers[b]->m_name)
+			{
+				separator(fp, first);
+				fprintf(fp, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", tid);
+				writeString(fp, buffers[b]->m_name);
+				fprintf(fp, "}}");
+			}
+
+			buffers[b]->copy(events);
+			open.clear();
+			for(size_t n=0; n<events.size(); ++n)
+			{
+				const ProfileEvent &event = events[n];
+				switch(event.type)
+				{
+				case EVENT_BEGIN:
+					open.push_back(&event);
+					break;
+
+				case EVENT_END:
+					// an end whose begin was overwritten is dropped
+					if(open.empty()) break;
+					separator(fp, first);
+					fprintf(fp, "{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"name\":", tid,
+						microseconds(open.back()->ticks), microseconds(event.ticks) - microseconds(open.back()->ticks));
+					writeString(fp, open.back()->name);
+					fprintf(fp, "}");
+					open.pop_back();
+					break;
+
+				case EVENT_FRAME:
+					separator(fp, first);
+					fprintf(fp, "{\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"name\":", tid, microseconds(event.ticks));
+					writeString(fp, event.name);
+					fprintf(fp, "}");
+					break;
+
+				case EVENT_COUNTER:
+					separator(fp, first);
+					fprintf(fp, "{\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"name\":", tid, microseconds(event.ticks));
+					writeString(fp, event.name);
+					fprintf(fp, ",\"args\":{\"value\":%.17g}}", event.value);
+					break;
+				}
+			}
+		}
+
+		fprintf(fp, "\n]}\n");
+		bool written = (ferror(fp) == 0);
+		fclose(fp);
+		return written;
+	}
+
+protected:
+	Profiler() : m_lock(0) {}
+
+	ProfileBuffer* attach()
+	{
+		ProfileBuffer *buffer = new ProfileBuffer;
+		lock();
+		m_buffers.push_back(buffer);
+		unlock();
+		return buffer;
+	}
+
+	void lock()
+	{
+		while(!m_lock.compareExchange(0, 1))
+		{
+			Thread::yield();
+		}
+	}
+
+	void unlock()
+	{
+		m_lock.store(0);
+	}
+
+	double microseconds(long long ticks) const
+	{
+		return m_clock.elapsed(ticks) * 1000000.0;
+	}
+
+	static void separator(FILE *fp, bool &first)
+	{
+		if(!first) fprintf(fp, ",\n");
+		first = false;
+	}
+
+	static void writeString(FILE *fp, const char *text)
+	{
+		fputc('"', fp);
+		for(; *text; ++text)
+		{
+			if(*text == '"' || *text == '\\') fputc('\\', fp);
+			if((unsigned char)*text >= 0x20) fputc(*text, fp);
+		}
+		fputc('"', fp);
+	}
+
+	//! every ring ever attached, guarded by m_lock; threads that exit keep theirs until the profiler goes
+	std::vector<ProfileBuffer*>	m_buffers;
+	AtomicInt	m_lock;
+
+	LogClock	m_clock;
+
+	Profiler(const Profiler&);
+	Profiler& operator=(const Profiler&);
+};
+
+//! Begin and end event of PROFILE_ZONE
+class ProfileZone
+{
+public:
+	explicit ProfileZone(const char *name) : m_buffer(Profiler::threadBuffer())
+	{
+		m_buffer->push(Profiler::EVENT_BEGIN, name, 0.0);
+	}
+
+	~ProfileZone()
+	{
+		m_buffer->push(Profiler::EVENT_END, 0, 0.0);
+	}
+
+private:
+	ProfileBuffer*	m_buffer;
+
+	ProfileZone(const ProfileZone&);
+	ProfileZone& operator=(const ProfileZone&);
+};
+
+#ifdef USE_PROFILER
+//! Created during static initialization, before any thread records
+static Profiler &profiler = Profiler::instance();
+#endif
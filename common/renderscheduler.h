@@ -0,0 +1,132 @@
+/*!
+	@brief On-demand render scheduling with dirty tracking
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/timer.h"
+
+/*!
+	Collects what changed since the last frame and decides when the next one is due.
+	Any number of invalidations before a frame is rendered collapse into that frame,
+	and frames are spaced at least one vsync interval apart.
+*/
+class RenderScheduler
+{
+public:
+	//! Sources that make the next frame differ from the last one
+	enum Dirty
+	{
+		DIRTY_NONE		= 0,
+		DIRTY_CAMERA	= 1 << 0,
+		DIRTY_TIME		= 1 << 1,
+		DIRTY_RESIZE	= 1 << 2,
+		DIRTY_PROPERTY	= 1 << 3,
+		DIRTY_ALL		= DIRTY_CAMERA | DIRTY_TIME | DIRTY_RESIZE | DIRTY_PROPERTY,
+	};
+
+	RenderScheduler() :
+		m_interval(1.0 / 60.0),
+		m_dirty(DIRTY_NONE),
+		m_pending(false),
+		m_lastFrame(-1.0),
+		m_frames(0),
+		m_skipped(0)
+	{
+	}
+
+	//! Minimum spacing between frames, normally the display refresh period
+	void setInterval(double seconds)
+	{
+		m_interval = std::max(seconds, 0.0);
+	}
+
+	double getInterval() const
+	{
+		return m_interval;
+	}
+
+	/*!
+		Mark sources dirty. Returns true when the caller has to schedule a frame,
+		false when one is already pending and will pick these changes up.
+	*/
+	bool invalidate(int dirty)
+	{
+		if(dirty == DIRTY_NONE)
+		{
+			++m_skipped;
+			return false;
+		}
+
+		m_dirty |= dirty;
+		if(m_pending)
+		{
+			++m_skipped;
+			return false;
+		}
+
+		m_pending = true;
+		return true;
+	}
+
+	//! Milliseconds to wait before the pending frame so it lands on the next interval
+	int getDelay() const
+	{
+		if(m_lastFrame < 0.0) return 0;
+
+		double wait = m_lastFrame + m_interval - m_clock.seconds();
+		return wait > 0.0 ? (int)ceil(wait * 1000.0) : 0;
+	}
+
+	//! Start a frame; returns and clears the dirty sources it has to cover
+	int beginFrame()
+	{
+		int dirty = m_dirty;
+		m_dirty = DIRTY_NONE;
+		m_pending = false;
+		m_lastFrame = m_clock.seconds();
+		++m_frames;
+		return dirty;
+	}
+
+	bool isPending() const
+	{
+		return m_pending;
+	}
+
+	int getDirty() const
+	{
+		return m_dirty;
+	}
+
+	//! Frames rendered so far
+	unsigned int getFrameCount() const
+	{
+		return m_frames;
+	}
+
+	//! Repaint requests that did not cost a frame, coalesced or with nothing dirty
+	unsigned int getSkippedCount() const
+	{
+		return m_skipped;
+	}
+
+	void resetCounters()
+	{
+		m_frames = 0;
+		m_skipped = 0;
+	}
+
+protected:
+	HighResolutionTimer	m_clock;
+
+	double	m_interval;
+	int		m_dirty;
+	bool	m_pending;
+	double	m_lastFrame;
+
+	unsigned int	m_frames;
+	unsigned int	m_skipped;
+};
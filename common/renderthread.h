@@ -0,0 +1,231 @@
+/*!
+	@brief Render thread fed by a command queue
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+#include "../common/spscqueue.h"
+#include "../common/thread.h"
+#include "../common/profiler.h"
+
+#include <deque>
+
+//! Message from the UI thread to the render thread
+struct RenderCommand
+{
+	enum Type
+	{
+		CAMERA = 0,		//!< a new camera snapshot was published
+		TIME,			//!< animation time changed
+		RESIZE,			//!< the window was resized
+		QUIT,
+	};
+
+	Type	type;
+	double	time;
+	unsigned int	width;
+	unsigned int	height;
+
+	static RenderCommand camera()
+	{
+		RenderCommand command = { CAMERA, 0.0, 0, 0 };
+		return command;
+	}
+
+	static RenderCommand setTime(double time)
+	{
+		RenderCommand command = { TIME, time, 0, 0 };
+		return command;
+	}
+
+	static RenderCommand resize(unsigned int width, unsigned int height)
+	{
+		RenderCommand command = { RESIZE, 0.0, width, height };
+		return command;
+	}
+
+	static RenderCommand quit()
+	{
+		RenderCommand command = { QUIT, 0.0, 0, 0 };
+		return command;
+	}
+};
+
+//! Implemented by the renderer; every call arrives on the render thread
+class RenderBackend
+{
+public:
+	virtual ~RenderBackend() {}
+
+	virtual void	renderLatchCamera() = 0;
+	virtual void	renderSetTime(double time) = 0;
+	virtual void	renderResize(unsigned int width, unsigned int height) = 0;
+
+	//! render() and present() one frame
+	virtual void	renderFrame() = 0;
+};
+
+/*!
+	Runs a RenderBackend on its own thread. The UI thread posts commands and
+	requests frames without ever waiting for the renderer: commands go through
+	a lock-free queue (spilling into a UI-side overflow list when it is full)
+	and frame requests collapse into a single flag.
+*/
+class RenderThread : public Thread
+{
+public:
+	enum
+	{
+		QUEUE_SIZE = 64,
+	};
+
+	explicit RenderThread(RenderBackend *backend) :
+		m_backend(backend),
+		m_frameRequested(0),
+		m_framesRendered(0),
+		m_quit(false)
+	{
+	}
+
+	virtual ~RenderThread()
+	{
+		stop();
+	}
+
+	//! UI thread: queue a command, never blocks
+	void post(const RenderCommand &command)
+	{
+		flushOverflow();
+		if(!m_overflow.empty() || !m_queue.push(command))
+		{
+			m_overflow.push_back(command);
+		}
+		m_wake.signal();
+	}
+
+	//! UI thread: render once more after the queued commands, never blocks
+	void requestFrame()
+	{
+		flushOverflow();
+		m_frameRequested.store(1);
+		m_wake.signal();
+	}
+
+	/*!
+		UI thread: retry commands that did not fit into the queue. post() and
+		requestFrame() do this as well; call it when neither follows soon.
+		Returns true while some are still waiting.
+	*/
+	bool flush()
+	{
+		flushOverflow();
+		m_wake.signal();
+		return !m_overflow.empty();
+	}
+
+	bool hasOverflow() const
+	{
+		return !m_overflow.empty();
+	}
+
+	//! UI thread: finish the queued commands and join
+	void stop()
+	{
+		if(!isStarted()) return;
+
+		post(RenderCommand::quit());
+		while(flush())
+		{
+			Thread::yield();
+		}
+		join();
+	}
+
+	//! Frames completed so far, readable from any thread
+	int framesRendered() const
+	{
+		return m_framesRendered.load();
+	}
+
+protected:
+	virtual void run()
+	{
+		PROFILE_THREAD("render");
+		m_quit = false;
+		while(!m_quit)
+		{
+			m_wake.wait();
+			drain();
+
+			if(!m_quit && m_frameRequested.exchange(0))
+			{
+				m_backend->renderFrame();
+				m_framesRendered.fetchAdd(1);
+			}
+		}
+	}
+
+	//! Apply every queued command; redundant camera and time messages collapse into one
+	void drain()
+	{
+		bool camera = false;
+		bool time = false;
+		double latestTime = 0.0;
+
+		RenderCommand command;
+		while(m_queue.pop(command))
+		{
+			switch(command.type)
+			{
+			case RenderCommand::CAMERA:
+				camera = true;
+				break;
+			case RenderCommand::TIME:
+				time = true;
+				latestTime = command.time;
+				break;
+			case RenderCommand::RESIZE:
+				m_backend->renderResize(command.width, command.height);
+				break;
+			case RenderCommand::QUIT:
+				m_quit = true;
+				break;
+			}
+		}
+
+		if(time)
+		{
+			m_backend->renderSetTime(latestTime);
+		}
+		if(camera)
+		{
+			m_backend->renderLatchCamera();
+		}
+	}
+
+	//! UI thread: move spilled commands into the queue as space frees up
+	void flushOverflow()
+	{
+		while(!m_overflow.empty() && m_queue.push(m_overflow.front()))
+		{
+			m_overflow.pop_front();
+		}
+	}
+
+	RenderBackend*	m_backend;
+
+	SpscQueue<RenderCommand, QUEUE_SIZE>	m_queue;
+
+	//! commands that did not fit, owned by the UI thread
+	std::deque<RenderCommand>	m_overflow;
+
+	Event		m_wake;
+	AtomicInt	m_frameRequested;
+	AtomicInt	m_framesRendered;
+
+	//! render thread only
+	bool		m_quit;
+};
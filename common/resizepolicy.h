@@ -0,0 +1,149 @@
+/*!
+	@brief Resize debouncing
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/timer.h"
+
+/*!
+	Decides when a window resize reaches the renderer. The first resize after a
+	quiet period goes through at once; the ones following it within the debounce
+	time are held back and only the last size is applied once they stop, so an
+	interactive drag costs two reallocations instead of one per mouse move.
+*/
+class ResizePolicy
+{
+public:
+	enum Action
+	{
+		ACTION_NONE = 0,	//!< nothing to do, the size is already applied
+		ACTION_DEFER,		//!< keep the current buffers, call settle() after getSettleDelay()
+		ACTION_APPLY,		//!< reallocate for getWidth() x getHeight() now
+	};
+
+	ResizePolicy() :
+		m_debounce(0.1),
+		m_lastRequest(-1.0),
+		m_width(0), m_height(0),
+		m_appliedWidth(0), m_appliedHeight(0),
+		m_pending(false),
+		m_applied(0),
+		m_deferred(0)
+	{
+	}
+
+	//! Quiet time in seconds after which a resize storm counts as over
+	void setDebounce(double seconds)
+	{
+		m_debounce = std::max(seconds, 0.0);
+	}
+
+	double getDebounce() const
+	{
+		return m_debounce;
+	}
+
+	//! UI thread: the window is now width x height
+	Action request(unsigned int width, unsigned int height)
+	{
+		double now = m_clock.seconds();
+		bool quiet = (m_lastRequest < 0.0) || (now - m_lastRequest >= m_debounce);
+		m_lastRequest = now;
+
+		m_width = width;
+		m_height = height;
+
+		if(width == m_appliedWidth && height == m_appliedHeight)
+		{
+			m_pending = false;
+			return ACTION_NONE;
+		}
+
+		if(quiet)
+		{
+			return apply();
+		}
+
+		m_pending = true;
+		++m_deferred;
+		return ACTION_DEFER;
+	}
+
+	//! Timer: ACTION_APPLY once no resize arrived for the debounce time, ACTION_DEFER while it is too early
+	Action settle()
+	{
+		if(!m_pending) return ACTION_NONE;
+		if(getSettleDelay() > 0) return ACTION_DEFER;
+		return apply();
+	}
+
+	//! Milliseconds until settle() can apply the held back size
+	int getSettleDelay() const
+	{
+		if(!m_pending) return 0;
+
+		double wait = m_lastRequest + m_debounce - m_clock.seconds();
+		return wait > 0.0 ? (int)ceil(wait * 1000.0) : 0;
+	}
+
+	bool isPending() const
+	{
+		return m_pending;
+	}
+
+	//! Size handed out by the last ACTION_APPLY
+	unsigned int getWidth() const
+	{
+		return m_appliedWidth;
+	}
+
+	unsigned int getHeight() const
+	{
+		return m_appliedHeight;
+	}
+
+	//! Forget the applied size so the next request() reallocates, e.g. after a device reset
+	void invalidate()
+	{
+		m_appliedWidth = m_appliedHeight = 0;
+	}
+
+	//! Resizes that reached the renderer
+	unsigned int getAppliedCount() const
+	{
+		return m_applied;
+	}
+
+	//! Resizes that were held back
+	unsigned int getDeferredCount() const
+	{
+		return m_deferred;
+	}
+
+protected:
+	Action apply()
+	{
+		m_pending = false;
+		m_appliedWidth = m_width;
+		m_appliedHeight = m_height;
+		++m_applied;
+		return ACTION_APPLY;
+	}
+
+	HighResolutionTimer	m_clock;
+
+	double	m_debounce;
+	double	m_lastRequest;
+
+	unsigned int	m_width;
+	unsigned int	m_height;
+	unsigned int	m_appliedWidth;
+	unsigned int	m_appliedHeight;
+	bool			m_pending;
+
+	unsigned int	m_applied;
+	unsigned int	m_deferred;
+};
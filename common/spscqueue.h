@@ -0,0 +1,70 @@
+/*!
+	@brief Lock-free single producer / single consumer ring buffer
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+#include "../common/atomic.h"
+
+/*!
+	Bounded FIFO for exactly one pushing and one popping thread.
+	Capacity must be a power of two; one slot is kept free to tell full from empty.
+*/
+template<class T, int Capacity>
+class SpscQueue
+{
+public:
+	typedef char CapacityCheck[((Capacity & (Capacity - 1)) == 0 && Capacity >= 2) ? 1 : -1];
+
+	SpscQueue() : m_head(0), m_tail(0)
+	{
+	}
+
+	//! Producer: false when full, the queue is left unchanged
+	bool push(const T &value)
+	{
+		int tail = m_tail.loadRelaxed();
+		int next = (tail + 1) & (Capacity - 1);
+		if(next == m_head.load()) return false;
+
+		m_items[tail] = value;
+		m_tail.store(next);
+		return true;
+	}
+
+	//! Consumer: false when empty
+	bool pop(T &value)
+	{
+		int head = m_head.loadRelaxed();
+		if(head == m_tail.load()) return false;
+
+		value = m_items[head];
+		m_head.store((head + 1) & (Capacity - 1));
+		return true;
+	}
+
+	//! Either side; only a snapshot while the other side runs
+	bool empty() const
+	{
+		return m_head.load() == m_tail.load();
+	}
+
+	int size() const
+	{
+		return (m_tail.load() - m_head.load()) & (Capacity - 1);
+	}
+
+protected:
+	T	m_items[Capacity];
+
+	//! next slot to pop, written by the consumer only
+	AtomicInt	m_head;
+
+	//! keeps the two indices on separate cache lines
+	char		m_padding[64];
+
+	//! next slot to push, written by the producer only
+	AtomicInt	m_tail;
+};
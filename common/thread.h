@@ -0,0 +1,206 @@
+/*!
+	@brief Minimal thread and event (Win32 / pthreads)
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#include <time.h>
+#endif
+
+//! Override run(); the owner has to join() before the object is destroyed
+class Thread
+{
+public:
+	Thread() : m_started(false)
+	{
+#ifdef _WIN32
+		m_handle = 0;
+		m_id = 0;
+#endif
+	}
+
+	virtual ~Thread()
+	{
+		assert(!m_started);
+	}
+
+	bool start()
+	{
+		if(m_started) return false;
+#ifdef _WIN32
+		m_handle = ::CreateThread(NULL, 0, entry, this, 0, &m_id);
+		m_started = (m_handle != 0);
+#else
+		m_started = (pthread_create(&m_thread, NULL, entry, this) == 0);
+#endif
+		return m_started;
+	}
+
+	//! wait for run() to return
+	void join()
+	{
+		if(!m_started) return;
+#ifdef _WIN32
+		::WaitForSingleObject(m_handle, INFINITE);
+		::CloseHandle(m_handle);
+		m_handle = 0;
+#else
+		pthread_join(m_thread, NULL);
+#endif
+		m_started = false;
+	}
+
+	bool isStarted() const
+	{
+		return m_started;
+	}
+
+	//! give up the rest of the calling thread's time slice
+	static void yield()
+	{
+#ifdef _WIN32
+		::SwitchToThread();
+#else
+		sched_yield();
+#endif
+	}
+
+	//! true when called from this thread
+	bool isCurrent() const
+	{
+		if(!m_started) return false;
+#ifdef _WIN32
+		return ::GetCurrentThreadId() == m_id;
+#else
+		return pthread_equal(pthread_self(), m_thread) != 0;
+#endif
+	}
+
+protected:
+	virtual void run() = 0;
+
+private:
+#ifdef _WIN32
+	static DWORD WINAPI entry(LPVOID param)
+	{
+		static_cast<Thread*>(param)->run();
+		return 0;
+	}
+
+	HANDLE	m_handle;
+	DWORD	m_id;
+#else
+	static void* entry(void *param)
+	{
+		static_cast<Thread*>(param)->run();
+		return NULL;
+	}
+
+	pthread_t	m_thread;
+#endif
+	bool	m_started;
+
+	Thread(const Thread&);
+	Thread& operator=(const Thread&);
+};
+
+//! Auto-reset event: signal() wakes one wait(), signals before the wait are not lost
+class Event
+{
+public:
+	Event()
+	{
+#ifdef _WIN32
+		m_event = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+#else
+		m_signaled = false;
+		pthread_mutex_init(&m_mutex, NULL);
+		pthread_cond_init(&m_cond, NULL);
+#endif
+	}
+
+	~Event()
+	{
+#ifdef _WIN32
+		::CloseHandle(m_event);
+#else
+		pthread_cond_destroy(&m_cond);
+		pthread_mutex_destroy(&m_mutex);
+#endif
+	}
+
+	void signal()
+	{
+#ifdef _WIN32
+		::SetEvent(m_event);
+#else
+		pthread_mutex_lock(&m_mutex);
+		m_signaled = true;
+		pthread_cond_signal(&m_cond);
+		pthread_mutex_unlock(&m_mutex);
+#endif
+	}
+
+	void wait()
+	{
+#ifdef _WIN32
+		::WaitForSingleObject(m_event, INFINITE);
+#else
+		pthread_mutex_lock(&m_mutex);
+		while(!m_signaled)
+		{
+			pthread_cond_wait(&m_cond, &m_mutex);
+		}
+		m_signaled = false;
+		pthread_mutex_unlock(&m_mutex);
+#endif
+	}
+
+	//! false on timeout
+	bool wait(unsigned int milliseconds)
+	{
+#ifdef _WIN32
+		return ::WaitForSingleObject(m_event, milliseconds) == WAIT_OBJECT_0;
+#else
+		timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += milliseconds / 1000;
+		deadline.tv_nsec += (long)(milliseconds % 1000) * 1000000L;
+		if(deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec += 1;
+			deadline.tv_nsec -= 1000000000L;
+		}
+
+		pthread_mutex_lock(&m_mutex);
+		int result = 0;
+		while(!m_signaled && result != ETIMEDOUT)
+		{
+			result = pthread_cond_timedwait(&m_cond, &m_mutex, &deadline);
+		}
+		bool signaled = m_signaled;
+		m_signaled = false;
+		pthread_mutex_unlock(&m_mutex);
+		return signaled;
+#endif
+	}
+
+private:
+#ifdef _WIN32
+	HANDLE	m_event;
+#else
+	pthread_mutex_t	m_mutex;
+	pthread_cond_t	m_cond;
+	bool			m_signaled;
+#endif
+
+	Event(const Event&);
+	Event& operator=(const Event&);
+};
@@ -0,0 +1,75 @@
+/*!
+	@brief High resolution timer
+	@author Shintaro Takemura
+*/
+
+#pragma once
+
+#include "../common/common.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+//! Monotonic wall-clock timer (QueryPerformanceCounter / CLOCK_MONOTONIC)
+class HighResolutionTimer
+{
+public:
+	HighResolutionTimer()
+	{
+		reset();
+	}
+
+	//! restart measurement from now
+	void reset()
+	{
+		m_start = ticks();
+	}
+
+	//! seconds elapsed since reset()
+	double seconds() const
+	{
+		return (double)(ticks() - m_start) / (double)frequency();
+	}
+
+	//! milliseconds elapsed since reset()
+	double milliseconds() const
+	{
+		return seconds() * 1000.0;
+	}
+
+	//! raw monotonic counter
+	static long long ticks()
+	{
+#ifdef _WIN32
+		LARGE_INTEGER counter;
+		::QueryPerformanceCounter(&counter);
+		return counter.QuadPart;
+#else
+		timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+	}
+
+	//! counter ticks per second
+	static long long frequency()
+	{
+#ifdef _WIN32
+		static long long s_frequency = 0;
+		if(s_frequency == 0)
+		{
+			LARGE_INTEGER freq;
+			::QueryPerformanceFrequency(&freq);
+			s_frequency = freq.QuadPart;
+		}
+		return s_frequency;
+#else
+		return 1000000000LL;
+#endif
+	}
+
+protected:
+	//! tick count at reset()
+	long long	m_start;
+};